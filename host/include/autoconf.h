@@ -0,0 +1,39 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+//
+// Kernel configuration of the host shim, forced into every translation
+// unit with -imacros like the Zephyr build does with its autoconf.h.
+//
+// Only the options the shim implements are enabled, the zpp headers
+// leave out the APIs of the others.
+//
+
+#ifndef ZPP_HOST_INCLUDE_AUTOCONF_H
+#define ZPP_HOST_INCLUDE_AUTOCONF_H
+
+#define CONFIG_ZPP_HOST_SHIM 1
+
+#define CONFIG_ASSERT 1
+#define CONFIG_TIMEOUT_64BIT 1
+#define CONFIG_THREAD_MONITOR 1
+#define CONFIG_THREAD_RUNTIME_STATS 1
+#define CONFIG_THREAD_STACK_INFO 1
+#define CONFIG_INIT_STACKS 1
+#define CONFIG_THREAD_LOCAL_STORAGE 1
+
+// one tick per microsecond, one cycle per nanosecond
+#define CONFIG_SYS_CLOCK_TICKS_PER_SEC 1000000
+#define CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC 1000000000
+
+#define CONFIG_NUM_COOP_PRIORITIES 16
+#define CONFIG_NUM_PREEMPT_PRIORITIES 15
+#define CONFIG_MAIN_THREAD_PRIORITY 0
+
+#define CONFIG_MP_MAX_NUM_CPUS 1
+#define CONFIG_MP_NUM_CPUS 1
+
+#endif // ZPP_HOST_INCLUDE_AUTOCONF_H
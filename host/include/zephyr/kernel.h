@@ -0,0 +1,731 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+//
+// The subset of the Zephyr kernel API zpp uses, implemented on top of
+// POSIX threads so the zpp headers and tests build as Linux programs.
+//
+// All kernel objects are protected by one big lock and every object has
+// its own wait queue, a pthread condition variable. Threads are real
+// pthreads that run in parallel, priorities are stored but not enforced
+// and k_sched_lock() does not stop other threads. Timer expiry functions
+// run on a timer thread that reports k_is_in_isr() as true.
+//
+// Not implemented: polling, pipes, mailboxes, futexes, user mode and
+// everything the zpp headers only use behind a Kconfig option that
+// autoconf.h leaves disabled.
+//
+
+#ifndef ZPP_HOST_INCLUDE_ZEPHYR_KERNEL_H
+#define ZPP_HOST_INCLUDE_ZEPHYR_KERNEL_H
+
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/slist.h>
+
+#ifdef __cplusplus
+#define Z_HOST_CONSTEXPR constexpr
+#else
+#define Z_HOST_CONSTEXPR
+#endif
+
+//
+// utilities
+//
+
+#ifndef BIT
+#define BIT(n) (1UL << (n))
+#endif
+
+#ifndef ARRAY_SIZE
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
+#endif
+
+#ifndef MIN
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+
+#ifndef MAX
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+
+#define ARG_UNUSED(x) (void)(x)
+
+#define CONTAINER_OF(ptr, type, field)                                    \
+  ((type*)(((char*)(ptr)) - offsetof(type, field)))
+
+#define ROUND_UP(x, align)                                                \
+  ((((unsigned long)(x) + ((unsigned long)(align) - 1)) /                 \
+    (unsigned long)(align)) * (unsigned long)(align))
+
+#define __aligned(x) __attribute__((__aligned__(x)))
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//
+// time
+//
+
+typedef int64_t k_ticks_t;
+
+typedef struct {
+  k_ticks_t ticks;
+} k_timeout_t;
+
+#define K_TICKS_FOREVER ((k_ticks_t)-1)
+
+#ifdef __cplusplus
+#define Z_TIMEOUT_TICKS(t) (k_timeout_t{ (k_ticks_t)(t) })
+#else
+#define Z_TIMEOUT_TICKS(t) ((k_timeout_t){ .ticks = (t) })
+#endif
+
+#define Z_TICK_ABS(t) (K_TICKS_FOREVER - 1 - (t))
+
+#define K_NO_WAIT Z_TIMEOUT_TICKS(0)
+#define K_FOREVER Z_TIMEOUT_TICKS(K_TICKS_FOREVER)
+#define SYS_FOREVER_MS (-1)
+#define K_TIMEOUT_EQ(a, b) ((a).ticks == (b).ticks)
+#define K_TIMEOUT_ABS_TICKS(t) Z_TIMEOUT_TICKS(Z_TICK_ABS((k_ticks_t)MAX((t), 0)))
+
+#define Z_HOST_NS_PER_TICK (1000000000LL / CONFIG_SYS_CLOCK_TICKS_PER_SEC)
+#define Z_HOST_NS_PER_CYC (1000000000LL / CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC)
+
+static Z_HOST_CONSTEXPR inline uint64_t k_ns_to_ticks_floor64(uint64_t t)
+{
+  return t / Z_HOST_NS_PER_TICK;
+}
+
+static Z_HOST_CONSTEXPR inline uint64_t k_ns_to_ticks_ceil64(uint64_t t)
+{
+  return (t + Z_HOST_NS_PER_TICK - 1) / Z_HOST_NS_PER_TICK;
+}
+
+static Z_HOST_CONSTEXPR inline uint64_t k_us_to_ticks_ceil64(uint64_t t)
+{
+  return k_ns_to_ticks_ceil64(t * 1000U);
+}
+
+static Z_HOST_CONSTEXPR inline uint64_t k_ms_to_ticks_ceil64(uint64_t t)
+{
+  return k_ns_to_ticks_ceil64(t * 1000000U);
+}
+
+static Z_HOST_CONSTEXPR inline uint32_t k_ms_to_ticks_ceil32(uint32_t t)
+{
+  return (uint32_t)k_ms_to_ticks_ceil64(t);
+}
+
+static Z_HOST_CONSTEXPR inline uint64_t k_ticks_to_ns_floor64(uint64_t t)
+{
+  return t * Z_HOST_NS_PER_TICK;
+}
+
+static Z_HOST_CONSTEXPR inline uint64_t k_ticks_to_us_floor64(uint64_t t)
+{
+  return k_ticks_to_ns_floor64(t) / 1000U;
+}
+
+static Z_HOST_CONSTEXPR inline uint64_t k_ticks_to_ms_floor64(uint64_t t)
+{
+  return k_ticks_to_ns_floor64(t) / 1000000U;
+}
+
+static Z_HOST_CONSTEXPR inline uint64_t k_ticks_to_ms_ceil64(uint64_t t)
+{
+  return (k_ticks_to_ns_floor64(t) + 999999U) / 1000000U;
+}
+
+static Z_HOST_CONSTEXPR inline uint64_t k_cyc_to_ns_floor64(uint64_t t)
+{
+  return t * Z_HOST_NS_PER_CYC;
+}
+
+static Z_HOST_CONSTEXPR inline uint32_t k_cyc_to_ns_floor32(uint32_t t)
+{
+  return (uint32_t)k_cyc_to_ns_floor64(t);
+}
+
+static Z_HOST_CONSTEXPR inline uint64_t k_cyc_to_us_floor64(uint64_t t)
+{
+  return k_cyc_to_ns_floor64(t) / 1000U;
+}
+
+static Z_HOST_CONSTEXPR inline uint32_t k_cyc_to_us_floor32(uint32_t t)
+{
+  return (uint32_t)k_cyc_to_us_floor64(t);
+}
+
+static Z_HOST_CONSTEXPR inline uint64_t k_ns_to_cyc_ceil64(uint64_t t)
+{
+  return (t + Z_HOST_NS_PER_CYC - 1) / Z_HOST_NS_PER_CYC;
+}
+
+static Z_HOST_CONSTEXPR inline uint64_t k_ticks_to_cyc_floor64(uint64_t t)
+{
+  return k_ns_to_cyc_ceil64(k_ticks_to_ns_floor64(t));
+}
+
+#define K_TICKS(t) Z_TIMEOUT_TICKS(t)
+#define K_NSEC(t) Z_TIMEOUT_TICKS(k_ns_to_ticks_ceil64(t))
+#define K_USEC(t) Z_TIMEOUT_TICKS(k_us_to_ticks_ceil64(t))
+#define K_MSEC(ms) Z_TIMEOUT_TICKS(k_ms_to_ticks_ceil64(ms))
+#define K_SECONDS(s) K_MSEC((s) * 1000)
+#define K_MINUTES(m) K_SECONDS((m) * 60)
+#define K_HOURS(h) K_MINUTES((h) * 60)
+
+static Z_HOST_CONSTEXPR inline uint32_t sys_clock_hw_cycles_per_sec(void)
+{
+  return CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC;
+}
+
+int64_t k_uptime_ticks(void);
+int64_t k_uptime_get(void);
+uint32_t k_uptime_get_32(void);
+uint32_t k_cycle_get_32(void);
+uint64_t k_cycle_get_64(void);
+void k_busy_wait(uint32_t usec_to_wait);
+
+//
+// wait queues, every blocking object has one
+//
+
+typedef struct {
+  pthread_cond_t cond;
+} _wait_q_t;
+
+#define Z_WAIT_Q_INIT(wait_q) { PTHREAD_COND_INITIALIZER }
+
+//
+// threads
+//
+
+struct z_thread_stack_element {
+  char data;
+};
+
+typedef struct z_thread_stack_element k_thread_stack_t;
+
+// the pthreads run on stacks of their own, the Zephyr stacks are only
+// there so the zpp stack objects have something to point to
+#define K_THREAD_STACK_LEN(size) (size)
+#define K_THREAD_STACK_SIZEOF(sym) sizeof(sym)
+#define K_THREAD_STACK_DEFINE(sym, size)                                  \
+  struct z_thread_stack_element __aligned(16) sym[(size)]
+#define K_THREAD_STACK_ARRAY_DEFINE(sym, nmemb, size)                     \
+  struct z_thread_stack_element __aligned(16) sym[nmemb][(size)]
+#define K_THREAD_PINNED_STACK_DEFINE(sym, size)                           \
+  K_THREAD_STACK_DEFINE(sym, size)
+#define K_THREAD_PINNED_STACK_ARRAY_DEFINE(sym, nmemb, size)              \
+  K_THREAD_STACK_ARRAY_DEFINE(sym, nmemb, size)
+#define K_KERNEL_STACK_DEFINE(sym, size) K_THREAD_STACK_DEFINE(sym, size)
+#define K_KERNEL_STACK_ARRAY_DEFINE(sym, nmemb, size)                     \
+  K_THREAD_STACK_ARRAY_DEFINE(sym, nmemb, size)
+#define K_KERNEL_PINNED_STACK_DEFINE(sym, size)                           \
+  K_THREAD_STACK_DEFINE(sym, size)
+#define K_KERNEL_PINNED_STACK_ARRAY_DEFINE(sym, nmemb, size)              \
+  K_THREAD_STACK_ARRAY_DEFINE(sym, nmemb, size)
+
+#define K_ESSENTIAL (BIT(0))
+#define K_FP_REGS (BIT(1))
+#define K_USER (BIT(2))
+#define K_INHERIT_PERMS (BIT(3))
+
+#define K_LOWEST_THREAD_PRIO (CONFIG_NUM_PREEMPT_PRIORITIES - 1)
+#define K_HIGHEST_THREAD_PRIO (-CONFIG_NUM_COOP_PRIORITIES)
+
+typedef void (*k_thread_entry_t)(void* p1, void* p2, void* p3);
+
+struct k_condvar;
+
+struct k_thread {
+  pthread_t          pthread;
+  _wait_q_t          wait_q;
+  k_thread_entry_t   entry;
+  void*              p1;
+  void*              p2;
+  void*              p3;
+  int                prio;
+  uint32_t           options;
+  uint32_t           state;
+  uint32_t           generation;
+  k_ticks_t          start_ticks;
+  size_t             stack_size;
+  pthread_cond_t*    pended_on;
+  struct k_condvar*  condvar;
+  struct k_thread*   condvar_next;
+  struct k_thread*   next_thread;
+  char               name[32];
+};
+
+typedef struct k_thread* k_tid_t;
+
+#define K_ANY NULL
+
+typedef void (*k_thread_user_cb_t)(const struct k_thread* thread,
+                                   void* user_data);
+
+k_tid_t k_thread_create(struct k_thread* new_thread, k_thread_stack_t* stack,
+                        size_t stack_size, k_thread_entry_t entry,
+                        void* p1, void* p2, void* p3,
+                        int prio, uint32_t options, k_timeout_t delay);
+void k_thread_start(k_tid_t thread);
+void k_thread_abort(k_tid_t thread);
+int k_thread_join(struct k_thread* thread, k_timeout_t timeout);
+void k_thread_suspend(k_tid_t thread);
+void k_thread_resume(k_tid_t thread);
+int k_thread_priority_get(k_tid_t thread);
+void k_thread_priority_set(k_tid_t thread, int prio);
+int k_thread_name_set(k_tid_t thread, const char* str);
+const char* k_thread_name_get(k_tid_t thread);
+void k_thread_foreach(k_thread_user_cb_t user_cb, void* user_data);
+k_tid_t k_current_get(void);
+
+// static threads are created by the initialization of a global, so
+// they can start before main() and other globals are initialized
+int z_host_thread_define(struct k_thread* new_thread, k_thread_stack_t* stack,
+                         size_t stack_size, k_thread_entry_t entry,
+                         void* p1, void* p2, void* p3,
+                         int prio, uint32_t options, int32_t delay);
+
+#define K_THREAD_DEFINE(name, stack_size, entry, p1, p2, p3,               \
+                        prio, options, delay)                              \
+  K_THREAD_STACK_DEFINE(_k_thread_stack_##name, stack_size);               \
+  struct k_thread _k_thread_obj_##name;                                    \
+  const k_tid_t name = &_k_thread_obj_##name;                              \
+  static const int _k_thread_init_##name __attribute__((unused)) =         \
+    z_host_thread_define(                                                  \
+    &_k_thread_obj_##name, _k_thread_stack_##name, (stack_size),           \
+    (k_thread_entry_t)(entry), (p1), (p2), (p3), (prio), (options), (delay))
+
+// the CPU time of the pthreads, in cycles
+typedef struct k_thread_runtime_stats {
+  uint64_t execution_cycles;
+} k_thread_runtime_stats_t;
+
+int k_thread_runtime_stats_get(k_tid_t thread,
+                               k_thread_runtime_stats_t* stats);
+int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t* stats);
+
+// measured from the stack pointer of the pthread, so only the current
+// thread can be asked and it is not a high water mark
+int k_thread_stack_space_get(const struct k_thread* thread,
+                             size_t* unused_ptr);
+
+int32_t k_sleep(k_timeout_t timeout);
+int32_t k_msleep(int32_t ms);
+int32_t k_usleep(int32_t us);
+void k_wakeup(k_tid_t thread);
+void k_yield(void);
+
+bool k_is_in_isr(void);
+
+// there is no scheduler to lock, other threads keep running
+void k_sched_lock(void);
+void k_sched_unlock(void);
+
+//
+// spinlocks
+//
+
+struct k_spinlock {
+  int locked;
+};
+
+typedef struct {
+  int key;
+} k_spinlock_key_t;
+
+k_spinlock_key_t k_spin_lock(struct k_spinlock* l);
+void k_spin_unlock(struct k_spinlock* l, k_spinlock_key_t key);
+
+//
+// semaphores
+//
+
+struct k_sem {
+  _wait_q_t    wait_q;
+  unsigned int count;
+  unsigned int limit;
+  uint32_t     resets;
+};
+
+#define K_SEM_MAX_LIMIT UINT_MAX
+
+#define Z_SEM_INITIALIZER(obj, initial_count, count_limit)                \
+  { Z_WAIT_Q_INIT(&obj.wait_q), (initial_count), (count_limit), 0 }
+
+#define K_SEM_DEFINE(name, initial_count, count_limit)                    \
+  struct k_sem name = Z_SEM_INITIALIZER(name, initial_count, count_limit)
+
+int k_sem_init(struct k_sem* sem, unsigned int initial_count,
+               unsigned int limit);
+int k_sem_take(struct k_sem* sem, k_timeout_t timeout);
+void k_sem_give(struct k_sem* sem);
+void k_sem_reset(struct k_sem* sem);
+unsigned int k_sem_count_get(struct k_sem* sem);
+
+//
+// mutexes
+//
+
+struct k_mutex {
+  _wait_q_t        wait_q;
+  struct k_thread* owner;
+  uint32_t         lock_count;
+};
+
+#define Z_MUTEX_INITIALIZER(obj) { Z_WAIT_Q_INIT(&obj.wait_q), NULL, 0 }
+
+#define K_MUTEX_DEFINE(name) struct k_mutex name = Z_MUTEX_INITIALIZER(name)
+
+int k_mutex_init(struct k_mutex* mutex);
+int k_mutex_lock(struct k_mutex* mutex, k_timeout_t timeout);
+int k_mutex_unlock(struct k_mutex* mutex);
+
+//
+// condition variables
+//
+
+struct k_condvar {
+  _wait_q_t        wait_q;
+  struct k_thread* head;
+  struct k_thread* tail;
+};
+
+#define Z_CONDVAR_INITIALIZER(obj) { Z_WAIT_Q_INIT(&obj.wait_q), NULL, NULL }
+
+#define K_CONDVAR_DEFINE(name)                                            \
+  struct k_condvar name = Z_CONDVAR_INITIALIZER(name)
+
+int k_condvar_init(struct k_condvar* condvar);
+int k_condvar_signal(struct k_condvar* condvar);
+int k_condvar_broadcast(struct k_condvar* condvar);
+int k_condvar_wait(struct k_condvar* condvar, struct k_mutex* mutex,
+                   k_timeout_t timeout);
+
+//
+// queues, the first word of every item is used as link
+//
+
+struct k_queue {
+  _wait_q_t wait_q;
+  void*     head;
+  void*     tail;
+  uint32_t  waiters;
+  uint32_t  cancels;
+};
+
+#define Z_QUEUE_INITIALIZER(obj)                                          \
+  { Z_WAIT_Q_INIT(&obj.wait_q), NULL, NULL, 0, 0 }
+
+void k_queue_init(struct k_queue* queue);
+void k_queue_cancel_wait(struct k_queue* queue);
+void k_queue_append(struct k_queue* queue, void* data);
+void k_queue_prepend(struct k_queue* queue, void* data);
+void k_queue_insert(struct k_queue* queue, void* prev, void* data);
+int k_queue_append_list(struct k_queue* queue, void* head, void* tail);
+int k_queue_merge_slist(struct k_queue* queue, sys_slist_t* list);
+void* k_queue_get(struct k_queue* queue, k_timeout_t timeout);
+bool k_queue_remove(struct k_queue* queue, void* data);
+int k_queue_is_empty(struct k_queue* queue);
+void* k_queue_peek_head(struct k_queue* queue);
+void* k_queue_peek_tail(struct k_queue* queue);
+
+struct k_fifo {
+  struct k_queue _queue;
+};
+
+#define Z_FIFO_INITIALIZER(obj) { Z_QUEUE_INITIALIZER(obj._queue) }
+#define K_FIFO_DEFINE(name) struct k_fifo name = Z_FIFO_INITIALIZER(name)
+
+#define k_fifo_init(fifo) k_queue_init(&(fifo)->_queue)
+#define k_fifo_cancel_wait(fifo) k_queue_cancel_wait(&(fifo)->_queue)
+#define k_fifo_put(fifo, data) k_queue_append(&(fifo)->_queue, data)
+#define k_fifo_put_list(fifo, head, tail)                                 \
+  k_queue_append_list(&(fifo)->_queue, head, tail)
+#define k_fifo_put_slist(fifo, list) k_queue_merge_slist(&(fifo)->_queue, list)
+#define k_fifo_get(fifo, timeout) k_queue_get(&(fifo)->_queue, timeout)
+#define k_fifo_is_empty(fifo) k_queue_is_empty(&(fifo)->_queue)
+#define k_fifo_peek_head(fifo) k_queue_peek_head(&(fifo)->_queue)
+#define k_fifo_peek_tail(fifo) k_queue_peek_tail(&(fifo)->_queue)
+
+struct k_lifo {
+  struct k_queue _queue;
+};
+
+#define Z_LIFO_INITIALIZER(obj) { Z_QUEUE_INITIALIZER(obj._queue) }
+#define K_LIFO_DEFINE(name) struct k_lifo name = Z_LIFO_INITIALIZER(name)
+
+#define k_lifo_init(lifo) k_queue_init(&(lifo)->_queue)
+#define k_lifo_put(lifo, data) k_queue_prepend(&(lifo)->_queue, data)
+#define k_lifo_get(lifo, timeout) k_queue_get(&(lifo)->_queue, timeout)
+
+//
+// stacks
+//
+
+typedef uintptr_t stack_data_t;
+
+struct k_stack {
+  _wait_q_t     wait_q;
+  stack_data_t* base;
+  stack_data_t* next;
+  stack_data_t* top;
+};
+
+#define Z_STACK_INITIALIZER(obj, stack_buffer, stack_num_entries)         \
+  { Z_WAIT_Q_INIT(&obj.wait_q), stack_buffer, stack_buffer,               \
+    (stack_buffer) + (stack_num_entries) }
+
+#define K_STACK_DEFINE(name, stack_num_entries)                           \
+  stack_data_t _k_stack_buf_##name[stack_num_entries];                    \
+  struct k_stack name =                                                   \
+    Z_STACK_INITIALIZER(name, _k_stack_buf_##name, stack_num_entries)
+
+void k_stack_init(struct k_stack* stack, stack_data_t* buffer,
+                  uint32_t num_entries);
+int k_stack_push(struct k_stack* stack, stack_data_t data);
+int k_stack_pop(struct k_stack* stack, stack_data_t* data,
+                k_timeout_t timeout);
+
+//
+// message queues
+//
+
+struct k_msgq {
+  _wait_q_t wait_q;
+  size_t    msg_size;
+  uint32_t  max_msgs;
+  char*     buffer_start;
+  char*     buffer_end;
+  char*     read_ptr;
+  char*     write_ptr;
+  uint32_t  used_msgs;
+};
+
+#define Z_MSGQ_INITIALIZER(obj, q_buffer, q_msg_size, q_max_msgs)         \
+  { Z_WAIT_Q_INIT(&obj.wait_q), (q_msg_size), (q_max_msgs), (q_buffer),   \
+    (q_buffer) + (q_max_msgs) * (q_msg_size), (q_buffer), (q_buffer), 0 }
+
+#define K_MSGQ_DEFINE(name, q_msg_size, q_max_msgs, q_align)              \
+  static char __attribute__((aligned(q_align)))                           \
+    _k_fifo_buf_##name[(q_max_msgs) * (q_msg_size)];                      \
+  struct k_msgq name =                                                    \
+    Z_MSGQ_INITIALIZER(name, _k_fifo_buf_##name, q_msg_size, q_max_msgs)
+
+void k_msgq_init(struct k_msgq* msgq, char* buffer, size_t msg_size,
+                 uint32_t max_msgs);
+int k_msgq_put(struct k_msgq* msgq, const void* data, k_timeout_t timeout);
+int k_msgq_get(struct k_msgq* msgq, void* data, k_timeout_t timeout);
+int k_msgq_peek(struct k_msgq* msgq, void* data);
+void k_msgq_purge(struct k_msgq* msgq);
+uint32_t k_msgq_num_free_get(struct k_msgq* msgq);
+uint32_t k_msgq_num_used_get(struct k_msgq* msgq);
+
+//
+// timers, the expiry functions run on the timer thread
+//
+
+struct k_timer;
+
+typedef void (*k_timer_expiry_t)(struct k_timer* timer);
+typedef void (*k_timer_stop_t)(struct k_timer* timer);
+
+struct k_timer {
+  _wait_q_t        wait_q;
+  k_timer_expiry_t expiry_fn;
+  k_timer_stop_t   stop_fn;
+  struct k_timer*  next;
+  k_ticks_t        expires;
+  k_ticks_t        period;
+  uint32_t         status;
+  bool             active;
+  void*            user_data;
+};
+
+#define Z_TIMER_INITIALIZER(obj, expiry, stop)                            \
+  { Z_WAIT_Q_INIT(&obj.wait_q), expiry, stop, NULL, 0, 0, 0, false, NULL }
+
+#define K_TIMER_DEFINE(name, expiry_fn, stop_fn)                          \
+  struct k_timer name = Z_TIMER_INITIALIZER(name, expiry_fn, stop_fn)
+
+void k_timer_init(struct k_timer* timer, k_timer_expiry_t expiry_fn,
+                  k_timer_stop_t stop_fn);
+void k_timer_start(struct k_timer* timer, k_timeout_t duration,
+                   k_timeout_t period);
+void k_timer_stop(struct k_timer* timer);
+uint32_t k_timer_status_get(struct k_timer* timer);
+uint32_t k_timer_status_sync(struct k_timer* timer);
+k_ticks_t k_timer_expires_ticks(const struct k_timer* timer);
+k_ticks_t k_timer_remaining_ticks(const struct k_timer* timer);
+
+static inline uint32_t k_timer_remaining_get(struct k_timer* timer)
+{
+  return (uint32_t)k_ticks_to_ms_floor64((uint64_t)k_timer_remaining_ticks(timer));
+}
+
+static inline void k_timer_user_data_set(struct k_timer* timer,
+                                         void* user_data)
+{
+  timer->user_data = user_data;
+}
+
+static inline void* k_timer_user_data_get(const struct k_timer* timer)
+{
+  return timer->user_data;
+}
+
+//
+// heaps, a first fit allocator in the buffer given to k_heap_init()
+//
+
+struct k_heap {
+  _wait_q_t wait_q;
+  void*     mem;
+  size_t    size;
+  bool      initialized;
+};
+
+#define K_HEAP_DEFINE(name, bytes)                                        \
+  char __aligned(16) kheap_##name[(bytes)];                               \
+  struct k_heap name = { Z_WAIT_Q_INIT(&name.wait_q), kheap_##name,       \
+                         (bytes), false }
+
+void k_heap_init(struct k_heap* h, void* mem, size_t bytes);
+void* k_heap_alloc(struct k_heap* h, size_t bytes, k_timeout_t timeout);
+void* k_heap_aligned_alloc(struct k_heap* h, size_t align, size_t bytes,
+                           k_timeout_t timeout);
+void k_heap_free(struct k_heap* h, void* mem);
+
+//
+// memory slabs
+//
+
+struct k_mem_slab {
+  _wait_q_t wait_q;
+  uint32_t  num_blocks;
+  size_t    block_size;
+  char*     buffer;
+  char*     free_list;
+  uint32_t  num_used;
+  bool      initialized;
+};
+
+#define K_MEM_SLAB_DEFINE(name, slab_block_size, slab_num_blocks, slab_align) \
+  char __aligned(slab_align)                                              \
+    _k_mem_slab_buf_##name[(slab_num_blocks) * (slab_block_size)];        \
+  struct k_mem_slab name = { Z_WAIT_Q_INIT(&name.wait_q),                 \
+                             (slab_num_blocks), (slab_block_size),        \
+                             _k_mem_slab_buf_##name, NULL, 0, false }
+
+int k_mem_slab_init(struct k_mem_slab* slab, void* buffer,
+                    size_t block_size, uint32_t num_blocks);
+int k_mem_slab_alloc(struct k_mem_slab* slab, void** mem,
+                     k_timeout_t timeout);
+void k_mem_slab_free(struct k_mem_slab* slab, void** mem);
+uint32_t k_mem_slab_num_used_get(struct k_mem_slab* slab);
+uint32_t k_mem_slab_num_free_get(struct k_mem_slab* slab);
+
+//
+// work queues
+//
+
+struct k_work;
+struct k_work_q;
+
+typedef void (*k_work_handler_t)(struct k_work* work);
+
+enum {
+  K_WORK_RUNNING = BIT(0),
+  K_WORK_CANCELING = BIT(1),
+  K_WORK_QUEUED = BIT(2),
+};
+
+struct k_work {
+  sys_snode_t      node;
+  k_work_handler_t handler;
+  struct k_work_q* queue;
+  uint32_t         flags;
+};
+
+#define Z_WORK_INITIALIZER(work_handler) { { NULL }, work_handler, NULL, 0 }
+
+struct k_work_sync {
+  int unused;
+};
+
+struct k_work_queue_config {
+  const char* name;
+  bool        no_yield;
+};
+
+struct k_work_q {
+  struct k_thread thread;
+  _wait_q_t       wait_q;
+  sys_slist_t     pending;
+  bool            started;
+};
+
+extern struct k_work_q k_sys_work_q;
+
+void k_work_init(struct k_work* work, k_work_handler_t handler);
+int k_work_busy_get(const struct k_work* work);
+bool k_work_is_pending(const struct k_work* work);
+int k_work_submit_to_queue(struct k_work_q* queue, struct k_work* work);
+int k_work_submit(struct k_work* work);
+int k_work_cancel(struct k_work* work);
+bool k_work_cancel_sync(struct k_work* work, struct k_work_sync* sync);
+bool k_work_flush(struct k_work* work, struct k_work_sync* sync);
+void k_work_queue_init(struct k_work_q* queue);
+void k_work_queue_start(struct k_work_q* queue, k_thread_stack_t* stack,
+                        size_t stack_size, int prio,
+                        const struct k_work_queue_config* cfg);
+
+//
+// mailboxes, declared so zpp/mbox.hpp compiles, not implemented
+//
+
+struct k_mbox {
+  _wait_q_t tx_msg_queue;
+  _wait_q_t rx_msg_queue;
+};
+
+struct k_mbox_msg {
+  size_t           size;
+  uint32_t         info;
+  void*            tx_data;
+  k_tid_t          rx_source_thread;
+  k_tid_t          tx_target_thread;
+};
+
+void k_mbox_init(struct k_mbox* mbox);
+int k_mbox_put(struct k_mbox* mbox, struct k_mbox_msg* tx_msg,
+               k_timeout_t timeout);
+int k_mbox_get(struct k_mbox* mbox, struct k_mbox_msg* rx_msg,
+               void* buffer, k_timeout_t timeout);
+
+//
+// console
+//
+
+void printk(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ZPP_HOST_INCLUDE_ZEPHYR_KERNEL_H
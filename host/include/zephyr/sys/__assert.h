@@ -0,0 +1,45 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_HOST_INCLUDE_ZEPHYR_SYS___ASSERT_H
+#define ZPP_HOST_INCLUDE_ZEPHYR_SYS___ASSERT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+[[noreturn]] void z_host_assert_fail(const char* file, int line,
+                                     const char* expr, const char* fmt, ...);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef CONFIG_ASSERT
+
+#define __ASSERT(test, fmt, ...)                                          \
+  do {                                                                    \
+    if (!(test)) {                                                        \
+      z_host_assert_fail(__FILE__, __LINE__, #test, fmt, ##__VA_ARGS__);  \
+    }                                                                     \
+  } while (false)
+
+#define __ASSERT_EVAL(expr1, expr2, test, fmt, ...)                       \
+  do {                                                                    \
+    expr2;                                                                \
+    __ASSERT(test, fmt, ##__VA_ARGS__);                                   \
+  } while (false)
+
+#else
+
+#define __ASSERT(test, fmt, ...) do { } while (false)
+#define __ASSERT_EVAL(expr1, expr2, test, fmt, ...) expr1
+
+#endif // CONFIG_ASSERT
+
+#define __ASSERT_NO_MSG(test) __ASSERT(test, "")
+
+#endif // ZPP_HOST_INCLUDE_ZEPHYR_SYS___ASSERT_H
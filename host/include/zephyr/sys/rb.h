@@ -0,0 +1,69 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+//
+// Red-black tree with the node layout and API of the Zephyr one. The
+// color of a node is kept in the low bit of its right child pointer.
+//
+
+#ifndef ZPP_HOST_INCLUDE_ZEPHYR_SYS_RB_H
+#define ZPP_HOST_INCLUDE_ZEPHYR_SYS_RB_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct rbnode {
+  struct rbnode* children[2];
+};
+
+#define Z_TBITS(t) ((sizeof(t)) < 8 ? 2 : 3)
+#define Z_PBITS(t) (8 * sizeof(t))
+#define Z_MAX_RBTREE_DEPTH (2 * (Z_PBITS(int*) - Z_TBITS(int*) - 1) + 1)
+
+typedef bool (*rb_lessthan_t)(struct rbnode* a, struct rbnode* b);
+
+struct rbtree {
+  struct rbnode* root;
+  rb_lessthan_t  lessthan_fn;
+  int            max_depth;
+};
+
+struct _rb_foreach {
+  struct rbnode** stack;
+  uint8_t*        is_left;
+  int32_t         top;
+};
+
+void rb_insert(struct rbtree* tree, struct rbnode* node);
+void rb_remove(struct rbtree* tree, struct rbnode* node);
+bool rb_contains(struct rbtree* tree, struct rbnode* node);
+struct rbnode* z_rb_get_minmax(struct rbtree* tree, uint8_t side);
+struct rbnode* z_rb_foreach_next(struct rbtree* tree, struct _rb_foreach* f);
+
+static inline struct rbnode* z_rb_child(struct rbnode* node, uint8_t side)
+{
+  return (struct rbnode*)((uintptr_t)node->children[side] & ~(uintptr_t)1);
+}
+
+static inline struct rbnode* rb_get_min(struct rbtree* tree)
+{
+  return z_rb_get_minmax(tree, 0U);
+}
+
+static inline struct rbnode* rb_get_max(struct rbtree* tree)
+{
+  return z_rb_get_minmax(tree, 1U);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ZPP_HOST_INCLUDE_ZEPHYR_SYS_RB_H
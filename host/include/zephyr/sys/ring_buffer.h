@@ -0,0 +1,92 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+//
+// Byte ring buffer with the layout and API of the Zephyr one, including
+// the claim and finish calls that give access to the buffer itself.
+//
+
+#ifndef ZPP_HOST_INCLUDE_ZEPHYR_SYS_RING_BUFFER_H
+#define ZPP_HOST_INCLUDE_ZEPHYR_SYS_RING_BUFFER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RING_BUFFER_MAX_SIZE 0x80000000U
+
+struct ring_buf {
+  uint8_t* buffer;
+  int32_t  put_head;
+  int32_t  put_tail;
+  int32_t  put_base;
+  int32_t  get_head;
+  int32_t  get_tail;
+  int32_t  get_base;
+  uint32_t size;
+};
+
+#define RING_BUF_DECLARE(name, size8)                                     \
+  static uint8_t _ring_buffer_data_##name[size8];                         \
+  struct ring_buf name = { _ring_buffer_data_##name, 0, 0, 0, 0, 0, 0, (size8) }
+
+static inline void ring_buf_reset(struct ring_buf* buf)
+{
+  buf->put_head = 0;
+  buf->put_tail = 0;
+  buf->put_base = 0;
+  buf->get_head = 0;
+  buf->get_tail = 0;
+  buf->get_base = 0;
+}
+
+static inline void ring_buf_init(struct ring_buf* buf, uint32_t size,
+                                 uint8_t* data)
+{
+  buf->buffer = data;
+  buf->size = size;
+  ring_buf_reset(buf);
+}
+
+static inline bool ring_buf_is_empty(struct ring_buf* buf)
+{
+  return buf->get_head == buf->put_tail;
+}
+
+static inline uint32_t ring_buf_space_get(struct ring_buf* buf)
+{
+  return buf->size - (uint32_t)(buf->put_head - buf->get_tail);
+}
+
+static inline uint32_t ring_buf_capacity_get(struct ring_buf* buf)
+{
+  return buf->size;
+}
+
+static inline uint32_t ring_buf_size_get(struct ring_buf* buf)
+{
+  return (uint32_t)(buf->put_tail - buf->get_tail);
+}
+
+uint32_t ring_buf_put_claim(struct ring_buf* buf, uint8_t** data,
+                            uint32_t size);
+int ring_buf_put_finish(struct ring_buf* buf, uint32_t size);
+uint32_t ring_buf_put(struct ring_buf* buf, const uint8_t* data,
+                      uint32_t size);
+
+uint32_t ring_buf_get_claim(struct ring_buf* buf, uint8_t** data,
+                            uint32_t size);
+int ring_buf_get_finish(struct ring_buf* buf, uint32_t size);
+uint32_t ring_buf_get(struct ring_buf* buf, uint8_t* data, uint32_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ZPP_HOST_INCLUDE_ZEPHYR_SYS_RING_BUFFER_H
@@ -0,0 +1,184 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_HOST_INCLUDE_ZEPHYR_SYS_SLIST_H
+#define ZPP_HOST_INCLUDE_ZEPHYR_SYS_SLIST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+struct _snode {
+  struct _snode* next;
+};
+
+typedef struct _snode sys_snode_t;
+
+struct _slist {
+  sys_snode_t* head;
+  sys_snode_t* tail;
+};
+
+typedef struct _slist sys_slist_t;
+
+#define SYS_SLIST_STATIC_INIT(ptr_to_list) { NULL, NULL }
+
+#define SYS_SLIST_FOR_EACH_NODE(__sl, __sn)                               \
+  for (__sn = sys_slist_peek_head(__sl); __sn != NULL;                    \
+       __sn = sys_slist_peek_next(__sn))
+
+static inline void sys_slist_init(sys_slist_t* list)
+{
+  list->head = NULL;
+  list->tail = NULL;
+}
+
+static inline bool sys_slist_is_empty(sys_slist_t* list)
+{
+  return list->head == NULL;
+}
+
+static inline sys_snode_t* sys_slist_peek_head(sys_slist_t* list)
+{
+  return list->head;
+}
+
+static inline sys_snode_t* sys_slist_peek_tail(sys_slist_t* list)
+{
+  return list->tail;
+}
+
+static inline sys_snode_t* sys_slist_peek_next_no_check(sys_snode_t* node)
+{
+  return node->next;
+}
+
+static inline sys_snode_t* sys_slist_peek_next(sys_snode_t* node)
+{
+  return node != NULL ? node->next : NULL;
+}
+
+static inline void sys_slist_prepend(sys_slist_t* list, sys_snode_t* node)
+{
+  node->next = list->head;
+  list->head = node;
+
+  if (list->tail == NULL) {
+    list->tail = node;
+  }
+}
+
+static inline void sys_slist_append(sys_slist_t* list, sys_snode_t* node)
+{
+  node->next = NULL;
+
+  if (list->tail == NULL) {
+    list->head = node;
+  } else {
+    list->tail->next = node;
+  }
+
+  list->tail = node;
+}
+
+static inline void sys_slist_append_list(sys_slist_t* list,
+                                         void* head, void* tail)
+{
+  if (head == NULL || tail == NULL) {
+    return;
+  }
+
+  if (list->tail == NULL) {
+    list->head = (sys_snode_t*)head;
+  } else {
+    list->tail->next = (sys_snode_t*)head;
+  }
+
+  list->tail = (sys_snode_t*)tail;
+}
+
+static inline void sys_slist_merge_slist(sys_slist_t* list,
+                                         sys_slist_t* list_to_append)
+{
+  sys_slist_append_list(list, list_to_append->head, list_to_append->tail);
+  sys_slist_init(list_to_append);
+}
+
+static inline void sys_slist_insert(sys_slist_t* list, sys_snode_t* prev,
+                                    sys_snode_t* node)
+{
+  if (prev == NULL) {
+    sys_slist_prepend(list, node);
+  } else if (prev->next == NULL) {
+    sys_slist_append(list, node);
+  } else {
+    node->next = prev->next;
+    prev->next = node;
+  }
+}
+
+static inline sys_snode_t* sys_slist_get_not_empty(sys_slist_t* list)
+{
+  sys_snode_t* node = list->head;
+
+  list->head = node->next;
+  if (list->tail == node) {
+    list->tail = list->head;
+  }
+
+  return node;
+}
+
+static inline sys_snode_t* sys_slist_get(sys_slist_t* list)
+{
+  return sys_slist_is_empty(list) ? NULL : sys_slist_get_not_empty(list);
+}
+
+static inline void sys_slist_remove(sys_slist_t* list, sys_snode_t* prev_node,
+                                    sys_snode_t* node)
+{
+  if (prev_node == NULL) {
+    list->head = node->next;
+    if (list->tail == node) {
+      list->tail = list->head;
+    }
+  } else {
+    prev_node->next = node->next;
+    if (list->tail == node) {
+      list->tail = prev_node;
+    }
+  }
+
+  node->next = NULL;
+}
+
+static inline bool sys_slist_find_and_remove(sys_slist_t* list,
+                                             sys_snode_t* node)
+{
+  sys_snode_t* prev = NULL;
+
+  for (sys_snode_t* test = list->head; test != NULL; test = test->next) {
+    if (test == node) {
+      sys_slist_remove(list, prev, node);
+      return true;
+    }
+    prev = test;
+  }
+
+  return false;
+}
+
+static inline size_t sys_slist_len(sys_slist_t* list)
+{
+  size_t len = 0;
+
+  for (sys_snode_t* n = list->head; n != NULL; n = n->next) {
+    len++;
+  }
+
+  return len;
+}
+
+#endif // ZPP_HOST_INCLUDE_ZEPHYR_SYS_SLIST_H
@@ -0,0 +1,13 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_HOST_INCLUDE_ZEPHYR_SYS_CLOCK_H
+#define ZPP_HOST_INCLUDE_ZEPHYR_SYS_CLOCK_H
+
+// everything lives in kernel.h on the host
+#include <zephyr/kernel.h>
+
+#endif // ZPP_HOST_INCLUDE_ZEPHYR_SYS_CLOCK_H
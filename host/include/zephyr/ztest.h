@@ -0,0 +1,96 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+//
+// The part of the ztest API the zpp tests use. Suites and tests register
+// themselves during static initialization and the main() of the test
+// runner runs them in the order they were defined.
+//
+// A failed assertion ends the test when it happens in the thread that
+// runs the test, in any other thread it is recorded and the thread goes
+// on.
+//
+
+#ifndef ZPP_HOST_INCLUDE_ZEPHYR_ZTEST_H
+#define ZPP_HOST_INCLUDE_ZEPHYR_ZTEST_H
+
+#include <zephyr/kernel.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef bool (*ztest_suite_predicate_t)(const void* global_state);
+typedef void* (*ztest_suite_setup_t)(void);
+typedef void (*ztest_suite_before_t)(void* fixture);
+typedef void (*ztest_suite_after_t)(void* fixture);
+typedef void (*ztest_suite_teardown_t)(void* fixture);
+
+int z_host_ztest_register_suite(const char* name,
+                                ztest_suite_predicate_t predicate,
+                                ztest_suite_setup_t setup,
+                                ztest_suite_before_t before,
+                                ztest_suite_after_t after,
+                                ztest_suite_teardown_t teardown);
+
+int z_host_ztest_register_test(const char* suite, const char* name,
+                               void (*fn)(void));
+
+// fmt is the optional, printf like, message of the assert, or NULL
+void z_host_ztest_fail(const char* file, int line, const char* msg,
+                       const char* fmt = NULL, ...);
+
+void ztest_test_fail(void);
+void ztest_test_pass(void);
+void ztest_test_skip(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define ZTEST_SUITE(suite_name, predicate, setup_fn, before_fn, after_fn,  \
+                    teardown_fn)                                          \
+  __attribute__((unused)) static const int z_ztest_suite_##suite_name =   \
+    z_host_ztest_register_suite(#suite_name, predicate, setup_fn,         \
+                                before_fn, after_fn, teardown_fn)
+
+#define ZTEST(suite, fn)                                                  \
+  static void suite##_##fn(void);                                         \
+  __attribute__((unused)) static const int z_ztest_test_##suite##_##fn =  \
+    z_host_ztest_register_test(#suite, #fn, suite##_##fn);                \
+  static void suite##_##fn(void)
+
+#define zassert(cond, default_msg, ...)                                   \
+  do {                                                                    \
+    if (!(cond)) {                                                        \
+      z_host_ztest_fail(__FILE__, __LINE__, default_msg                   \
+                        __VA_OPT__(,) __VA_ARGS__);                       \
+    }                                                                     \
+  } while (0)
+
+#define zassert_unreachable(...) zassert(0, "Reached unreachable code", __VA_ARGS__)
+#define zassert_true(cond, ...) zassert(cond, #cond " is false", __VA_ARGS__)
+#define zassert_false(cond, ...) zassert(!(cond), #cond " is true", __VA_ARGS__)
+#define zassert_ok(cond, ...) zassert(!(cond), #cond " is non-zero", __VA_ARGS__)
+#define zassert_is_null(ptr, ...) zassert((ptr) == NULL, #ptr " is not NULL", __VA_ARGS__)
+#define zassert_not_null(ptr, ...) zassert((ptr) != NULL, #ptr " is NULL", __VA_ARGS__)
+#define zassert_equal(a, b, ...) zassert((a) == (b), #a " not equal to " #b, __VA_ARGS__)
+#define zassert_not_equal(a, b, ...) zassert((a) != (b), #a " equal to " #b, __VA_ARGS__)
+#define zassert_equal_ptr(a, b, ...)                                      \
+  zassert((void*)(a) == (void*)(b), #a " not equal to " #b, __VA_ARGS__)
+#define zassert_within(a, b, d, ...)                                      \
+  zassert(((a) >= ((b) - (d))) && ((a) <= ((b) + (d))),                   \
+          #a " not within " #b " +/- " #d, __VA_ARGS__)
+#define zassert_between_inclusive(a, l, u, ...)                           \
+  zassert(((a) >= (l)) && ((a) <= (u)),                                   \
+          #a " not between " #l " and " #u " inclusive", __VA_ARGS__)
+#define zassert_mem_equal(buf, exp, size, ...)                            \
+  zassert(memcmp(buf, exp, size) == 0, #buf " not equal to " #exp, __VA_ARGS__)
+
+#endif // ZPP_HOST_INCLUDE_ZEPHYR_ZTEST_H
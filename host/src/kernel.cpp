@@ -0,0 +1,2113 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <zephyr/kernel.h>
+
+#include <csetjmp>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+namespace {
+
+//
+// The big kernel lock, every kernel object is protected by it. The list
+// of threads has a lock of its own, so threads that were not created by
+// k_thread_create() can be adopted with or without the big lock held.
+//
+pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+pthread_mutex_t g_thread_list_lock = PTHREAD_MUTEX_INITIALIZER;
+struct k_thread* g_thread_list = nullptr;
+
+enum : uint32_t {
+  thread_started = BIT(0),
+  thread_dead = BIT(1),
+  thread_suspended = BIT(2),
+  thread_sleeping = BIT(3),
+  thread_woken = BIT(4),
+  thread_idle = BIT(5),
+};
+
+// per pthread state
+struct self_state {
+  struct k_thread* thread{ nullptr };
+  uint32_t         generation{ 0 };
+  bool             created{ false };
+  bool             in_isr{ false };
+  jmp_buf          exit;
+};
+
+thread_local self_state t_self;
+
+uint64_t mono_ns() noexcept
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000000U
+    + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+uint64_t boot_ns() noexcept
+{
+  static const uint64_t boot = mono_ns();
+  return boot;
+}
+
+uint64_t uptime_ns() noexcept
+{
+  // the boot time must be taken before now on the first call
+  auto boot = boot_ns();
+  return mono_ns() - boot;
+}
+
+k_ticks_t uptime_ticks() noexcept
+{
+  return static_cast<k_ticks_t>(k_ns_to_ticks_floor64(uptime_ns()));
+}
+
+timespec to_timespec(uint64_t ns) noexcept
+{
+  timespec ts;
+  ts.tv_sec = static_cast<time_t>(ns / 1000000000U);
+  ts.tv_nsec = static_cast<long>(ns % 1000000000U);
+  return ts;
+}
+
+// the uptime in ticks at which a timeout, relative or absolute, expires
+k_ticks_t deadline_ticks(k_timeout_t timeout) noexcept
+{
+  if (timeout.ticks < K_TICKS_FOREVER) {
+    return Z_TICK_ABS(timeout.ticks);
+  }
+
+  return uptime_ticks() + MAX(timeout.ticks, 0);
+}
+
+void init_wait_q(_wait_q_t* wq) noexcept
+{
+  pthread_cond_init(&wq->cond, nullptr);
+}
+
+void wake_all(_wait_q_t* wq) noexcept
+{
+  pthread_cond_broadcast(&wq->cond);
+}
+
+void list_add(struct k_thread* t) noexcept
+{
+  pthread_mutex_lock(&g_thread_list_lock);
+  t->next_thread = g_thread_list;
+  g_thread_list = t;
+  pthread_mutex_unlock(&g_thread_list_lock);
+}
+
+void list_remove(struct k_thread* t) noexcept
+{
+  pthread_mutex_lock(&g_thread_list_lock);
+  for (auto pp = &g_thread_list; *pp != nullptr; pp = &(*pp)->next_thread) {
+    if (*pp == t) {
+      *pp = t->next_thread;
+      break;
+    }
+  }
+  t->next_thread = nullptr;
+  pthread_mutex_unlock(&g_thread_list_lock);
+}
+
+void init_thread(struct k_thread* t, const char* name, int prio) noexcept
+{
+  init_wait_q(&t->wait_q);
+  t->entry = nullptr;
+  t->p1 = nullptr;
+  t->p2 = nullptr;
+  t->p3 = nullptr;
+  t->prio = prio;
+  t->options = 0;
+  t->state = 0;
+  t->start_ticks = 0;
+  t->stack_size = 0;
+  t->pended_on = nullptr;
+  t->condvar = nullptr;
+  t->condvar_next = nullptr;
+  t->next_thread = nullptr;
+  strncpy(t->name, name, sizeof(t->name) - 1);
+  t->name[sizeof(t->name) - 1] = '\0';
+}
+
+// a pthread that was not created by k_thread_create(), like main(),
+// gets a thread object the first time it needs one
+struct adopted_thread {
+  struct k_thread thread{};
+  bool            listed{ false };
+
+  ~adopted_thread()
+  {
+    if (listed) {
+      list_remove(&thread);
+    }
+  }
+};
+
+thread_local adopted_thread t_adopted;
+
+// there is no idle thread, but like on Zephyr there is one in the list
+struct idle_thread {
+  struct k_thread thread{};
+
+  idle_thread()
+  {
+    init_thread(&thread, "idle", K_LOWEST_THREAD_PRIO);
+    thread.state = thread_started | thread_idle;
+    list_add(&thread);
+  }
+};
+
+idle_thread g_idle;
+
+struct k_thread* current() noexcept
+{
+  if (t_self.thread == nullptr) {
+    auto t = &t_adopted.thread;
+    init_thread(t, getpid() == gettid() ? "main" : "",
+                CONFIG_MAIN_THREAD_PRIORITY);
+    t->pthread = pthread_self();
+    t->state = thread_started;
+    t_self.thread = t;
+    list_add(t);
+    t_adopted.listed = true;
+  }
+
+  return t_self.thread;
+}
+
+void unlock() noexcept
+{
+  pthread_mutex_unlock(&g_lock);
+}
+
+// with the lock held, let a created thread that was aborted by another
+// thread leave, and one that was suspended by another thread wait
+void check_self() noexcept
+{
+  auto& self = t_self;
+
+  if (!self.created) {
+    return;
+  }
+
+  while (true) {
+    auto t = self.thread;
+    if (t->generation != self.generation || (t->state & thread_dead) != 0) {
+      unlock();
+      longjmp(self.exit, 1);
+    }
+
+    if ((t->state & thread_suspended) == 0) {
+      return;
+    }
+
+    pthread_cond_wait(&t->wait_q.cond, &g_lock);
+  }
+}
+
+void lock() noexcept
+{
+  pthread_mutex_lock(&g_lock);
+  check_self();
+}
+
+//
+// Wait, with the lock held, until ready() returns true or the timeout
+// expires. Returns the last result of ready().
+//
+template<class T_Ready>
+bool wait(_wait_q_t* wq, k_timeout_t timeout, T_Ready ready) noexcept
+{
+  if (ready()) {
+    return true;
+  }
+
+  if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+    return false;
+  }
+
+  auto t = current();
+  bool forever = K_TIMEOUT_EQ(timeout, K_FOREVER);
+  timespec deadline{};
+
+  if (!forever) {
+    deadline = to_timespec(boot_ns()
+      + k_ticks_to_ns_floor64(static_cast<uint64_t>(deadline_ticks(timeout))));
+  }
+
+  t->pended_on = &wq->cond;
+
+  bool res = true;
+  while (!ready()) {
+    int rc;
+    if (forever) {
+      rc = pthread_cond_wait(&wq->cond, &g_lock);
+    } else {
+      rc = pthread_cond_clockwait(&wq->cond, &g_lock, CLOCK_MONOTONIC,
+                                  &deadline);
+    }
+
+    check_self();
+
+    if (rc == ETIMEDOUT) {
+      res = ready();
+      break;
+    }
+  }
+
+  t->pended_on = nullptr;
+
+  return res;
+}
+
+int timeout_error(k_timeout_t timeout) noexcept
+{
+  return K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? -EBUSY : -EAGAIN;
+}
+
+void condvar_remove(struct k_condvar* cv, struct k_thread* t) noexcept
+{
+  struct k_thread* prev = nullptr;
+
+  for (auto n = cv->head; n != nullptr; n = n->condvar_next) {
+    if (n == t) {
+      if (prev == nullptr) {
+        cv->head = n->condvar_next;
+      } else {
+        prev->condvar_next = n->condvar_next;
+      }
+      if (cv->tail == n) {
+        cv->tail = prev;
+      }
+      break;
+    }
+    prev = n;
+  }
+
+  t->condvar = nullptr;
+  t->condvar_next = nullptr;
+}
+
+// with the lock held
+void mark_dead(struct k_thread* t) noexcept
+{
+  t->state |= thread_dead;
+
+  if (t->condvar != nullptr) {
+    condvar_remove(t->condvar, t);
+  }
+
+  list_remove(t);
+  wake_all(&t->wait_q);
+
+  if (t->pended_on != nullptr) {
+    pthread_cond_broadcast(t->pended_on);
+    t->pended_on = nullptr;
+  }
+}
+
+struct start_info {
+  struct k_thread* thread;
+  uint32_t         generation;
+};
+
+void* thread_main(void* arg)
+{
+  auto info = *static_cast<start_info*>(arg);
+  delete static_cast<start_info*>(arg);
+
+  struct k_thread* const t = info.thread;
+
+  t_self.thread = t;
+  t_self.generation = info.generation;
+  t_self.created = true;
+
+  // k_thread_abort() jumps back here
+  if (setjmp(t_self.exit) == 0) {
+    lock();
+
+    wait(&t->wait_q, K_FOREVER, [t] {
+      return (t->state & thread_started) != 0;
+    });
+
+    if (t->start_ticks > 0) {
+      wait(&t->wait_q, K_TIMEOUT_ABS_TICKS(t->start_ticks), [t] {
+        return t->start_ticks == 0;
+      });
+      t->start_ticks = 0;
+    }
+
+    auto entry = t->entry;
+    auto p1 = t->p1;
+    auto p2 = t->p2;
+    auto p3 = t->p3;
+
+    unlock();
+
+    entry(p1, p2, p3);
+  }
+
+  pthread_mutex_lock(&g_lock);
+  if (t->generation == info.generation && (t->state & thread_dead) == 0) {
+    mark_dead(t);
+  }
+  pthread_mutex_unlock(&g_lock);
+
+  return nullptr;
+}
+
+//
+// heap, chunks are kept in address order, free chunks are merged with
+// their neighbours
+//
+struct chunk_hdr {
+  size_t     size;       // the whole chunk, header included
+  size_t     prev_size;  // 0 for the first chunk
+  size_t     used;
+  chunk_hdr* self;       // right before the payload, k_heap_free() uses it
+};
+
+static_assert(sizeof(chunk_hdr) % 16 == 0);
+
+constexpr size_t heap_align = 16;
+
+chunk_hdr* heap_first(struct k_heap* h) noexcept
+{
+  return static_cast<chunk_hdr*>(h->mem);
+}
+
+bool heap_end(struct k_heap* h, chunk_hdr* c) noexcept
+{
+  return reinterpret_cast<char*>(c) >= static_cast<char*>(h->mem) + h->size;
+}
+
+chunk_hdr* heap_next(chunk_hdr* c) noexcept
+{
+  return reinterpret_cast<chunk_hdr*>(reinterpret_cast<char*>(c) + c->size);
+}
+
+void heap_init_locked(struct k_heap* h, void* mem, size_t bytes) noexcept
+{
+  auto addr = reinterpret_cast<uintptr_t>(mem);
+  auto aligned = ROUND_UP(addr, heap_align);
+  auto skip = aligned - addr;
+
+  h->mem = reinterpret_cast<void*>(aligned);
+  h->size = bytes > skip ? ((bytes - skip) / heap_align) * heap_align : 0;
+  h->initialized = true;
+
+  if (h->size >= sizeof(chunk_hdr) + heap_align) {
+    auto c = heap_first(h);
+    c->size = h->size;
+    c->prev_size = 0;
+    c->used = 0;
+    c->self = c;
+  } else {
+    h->size = 0;
+  }
+}
+
+void* heap_alloc_locked(struct k_heap* h, size_t align, size_t bytes) noexcept
+{
+  if (bytes == 0 || h->size == 0) {
+    return nullptr;
+  }
+
+  size_t extra = align > heap_align ? align : 0;
+  size_t need = sizeof(chunk_hdr) + ROUND_UP(bytes + extra, heap_align);
+
+  for (auto c = heap_first(h); !heap_end(h, c); c = heap_next(c)) {
+    if (c->used != 0 || c->size < need) {
+      continue;
+    }
+
+    if (c->size - need >= sizeof(chunk_hdr) + heap_align) {
+      auto n = reinterpret_cast<chunk_hdr*>(reinterpret_cast<char*>(c) + need);
+      n->size = c->size - need;
+      n->prev_size = need;
+      n->used = 0;
+      n->self = n;
+
+      auto nn = heap_next(n);
+      if (!heap_end(h, nn)) {
+        nn->prev_size = n->size;
+      }
+
+      c->size = need;
+    }
+
+    c->used = 1;
+    c->self = c;
+
+    auto payload = reinterpret_cast<char*>(c + 1);
+    if (extra == 0) {
+      return payload;
+    }
+
+    auto p = reinterpret_cast<char*>(
+      ROUND_UP(reinterpret_cast<uintptr_t>(payload), align));
+    reinterpret_cast<chunk_hdr**>(p)[-1] = c;
+    return p;
+  }
+
+  return nullptr;
+}
+
+void heap_free_locked(struct k_heap* h, void* mem) noexcept
+{
+  auto c = reinterpret_cast<chunk_hdr**>(mem)[-1];
+
+  __ASSERT(c->used != 0 && c->self == c, "bad pointer %p", mem);
+
+  c->used = 0;
+
+  auto n = heap_next(c);
+  if (!heap_end(h, n) && n->used == 0) {
+    c->size += n->size;
+  }
+
+  if (c->prev_size != 0) {
+    auto p = reinterpret_cast<chunk_hdr*>(
+      reinterpret_cast<char*>(c) - c->prev_size);
+    if (p->used == 0) {
+      p->size += c->size;
+      c = p;
+    }
+  }
+
+  n = heap_next(c);
+  if (!heap_end(h, n)) {
+    n->prev_size = c->size;
+  }
+}
+
+//
+// memory slabs
+//
+void mem_slab_init_locked(struct k_mem_slab* slab, void* buffer,
+                          size_t block_size, uint32_t num_blocks) noexcept
+{
+  slab->num_blocks = num_blocks;
+  slab->block_size = block_size;
+  slab->buffer = static_cast<char*>(buffer);
+  slab->free_list = nullptr;
+  slab->num_used = 0;
+  slab->initialized = true;
+
+  for (uint32_t i = num_blocks; i > 0; --i) {
+    auto block = slab->buffer + (i - 1) * block_size;
+    *reinterpret_cast<char**>(block) = slab->free_list;
+    slab->free_list = block;
+  }
+}
+
+//
+// timers, expiry functions run on the timer thread
+//
+struct k_timer* g_timers = nullptr;
+struct k_timer* g_timer_running = nullptr;
+pthread_cond_t g_timer_cond = PTHREAD_COND_INITIALIZER;
+pthread_cond_t g_timer_done_cond = PTHREAD_COND_INITIALIZER;
+bool g_timer_thread_started = false;
+
+void timer_insert(struct k_timer* timer) noexcept
+{
+  auto pp = &g_timers;
+  while (*pp != nullptr && (*pp)->expires <= timer->expires) {
+    pp = &(*pp)->next;
+  }
+
+  timer->next = *pp;
+  *pp = timer;
+
+  if (g_timers == timer) {
+    pthread_cond_signal(&g_timer_cond);
+  }
+}
+
+void timer_remove(struct k_timer* timer) noexcept
+{
+  for (auto pp = &g_timers; *pp != nullptr; pp = &(*pp)->next) {
+    if (*pp == timer) {
+      *pp = timer->next;
+      break;
+    }
+  }
+
+  timer->next = nullptr;
+}
+
+void* timer_main(void*)
+{
+  t_self.in_isr = true;
+
+  pthread_mutex_lock(&g_lock);
+
+  while (true) {
+    auto t = g_timers;
+
+    if (t == nullptr) {
+      pthread_cond_wait(&g_timer_cond, &g_lock);
+      continue;
+    }
+
+    if (t->expires > uptime_ticks()) {
+      auto deadline = to_timespec(boot_ns()
+        + k_ticks_to_ns_floor64(static_cast<uint64_t>(t->expires)));
+      pthread_cond_clockwait(&g_timer_cond, &g_lock, CLOCK_MONOTONIC,
+                             &deadline);
+      continue;
+    }
+
+    g_timers = t->next;
+    t->next = nullptr;
+    t->status++;
+
+    if (t->period > 0) {
+      t->expires += t->period;
+      timer_insert(t);
+    } else {
+      t->active = false;
+    }
+
+    wake_all(&t->wait_q);
+
+    if (t->expiry_fn != nullptr) {
+      g_timer_running = t;
+      pthread_mutex_unlock(&g_lock);
+
+      t->expiry_fn(t);
+
+      pthread_mutex_lock(&g_lock);
+      g_timer_running = nullptr;
+      pthread_cond_broadcast(&g_timer_done_cond);
+    }
+  }
+
+  return nullptr;
+}
+
+// with the lock held
+void start_timer_thread() noexcept
+{
+  if (g_timer_thread_started) {
+    return;
+  }
+
+  pthread_attr_t attr;
+  pthread_attr_init(&attr);
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+  pthread_t thread;
+  int rc = pthread_create(&thread, &attr, timer_main, nullptr);
+  __ASSERT(rc == 0, "can not create timer thread (%d)", rc);
+  (void)rc;
+
+  pthread_attr_destroy(&attr);
+
+  g_timer_thread_started = true;
+}
+
+//
+// mutex internals, with the lock held
+//
+int mutex_lock_locked(struct k_mutex* mutex, k_timeout_t timeout) noexcept
+{
+  auto t = current();
+
+  if (mutex->owner == t) {
+    mutex->lock_count++;
+    return 0;
+  }
+
+  if (!wait(&mutex->wait_q, timeout, [mutex] { return mutex->owner == nullptr; })) {
+    return timeout_error(timeout);
+  }
+
+  mutex->owner = t;
+  mutex->lock_count = 1;
+
+  return 0;
+}
+
+int mutex_unlock_locked(struct k_mutex* mutex) noexcept
+{
+  if (mutex->owner == nullptr) {
+    return -EINVAL;
+  }
+
+  if (mutex->owner != current()) {
+    return -EPERM;
+  }
+
+  if (--mutex->lock_count == 0) {
+    mutex->owner = nullptr;
+    wake_all(&mutex->wait_q);
+  }
+
+  return 0;
+}
+
+//
+// queue internals, with the lock held
+//
+void*& queue_link(void* item) noexcept
+{
+  return *static_cast<void**>(item);
+}
+
+void queue_insert_locked(struct k_queue* queue, void* prev, void* data) noexcept
+{
+  if (prev == nullptr) {
+    queue_link(data) = queue->head;
+    queue->head = data;
+    if (queue->tail == nullptr) {
+      queue->tail = data;
+    }
+  } else {
+    queue_link(data) = queue_link(prev);
+    queue_link(prev) = data;
+    if (queue->tail == prev) {
+      queue->tail = data;
+    }
+  }
+
+  wake_all(&queue->wait_q);
+}
+
+//
+// work queues
+//
+K_KERNEL_STACK_DEFINE(g_sys_work_q_stack, 4096);
+pthread_once_t g_sys_work_q_once = PTHREAD_ONCE_INIT;
+
+void work_q_main(void* p1, void*, void*)
+{
+  auto queue = static_cast<struct k_work_q*>(p1);
+
+  lock();
+
+  while (true) {
+    wait(&queue->wait_q, K_FOREVER, [queue] {
+      return !sys_slist_is_empty(&queue->pending);
+    });
+
+    auto work = reinterpret_cast<struct k_work*>(sys_slist_get(&queue->pending));
+    work->flags &= ~K_WORK_QUEUED;
+    work->flags |= K_WORK_RUNNING;
+    auto handler = work->handler;
+
+    unlock();
+
+    handler(work);
+
+    lock();
+
+    work->flags &= ~K_WORK_RUNNING;
+    wake_all(&queue->wait_q);
+  }
+}
+
+void start_sys_work_q()
+{
+  static const struct k_work_queue_config cfg{ "sysworkq", false };
+
+  k_work_queue_start(&k_sys_work_q, g_sys_work_q_stack,
+                     K_THREAD_STACK_SIZEOF(g_sys_work_q_stack),
+                     -1, &cfg);
+}
+
+// with the lock held, wait until a running work item is done, unless it
+// is the caller itself
+void work_wait_idle_locked(struct k_work* work, uint32_t flags) noexcept
+{
+  auto queue = work->queue;
+
+  if (queue == nullptr || current() == &queue->thread) {
+    return;
+  }
+
+  wait(&queue->wait_q, K_FOREVER, [work, flags] {
+    return (work->flags & flags) == 0;
+  });
+}
+
+} // namespace
+
+extern "C" {
+
+//
+// time
+//
+
+int64_t k_uptime_ticks(void)
+{
+  return uptime_ticks();
+}
+
+int64_t k_uptime_get(void)
+{
+  return static_cast<int64_t>(uptime_ns() / 1000000U);
+}
+
+uint32_t k_uptime_get_32(void)
+{
+  return static_cast<uint32_t>(k_uptime_get());
+}
+
+uint32_t k_cycle_get_32(void)
+{
+  return static_cast<uint32_t>(k_cycle_get_64());
+}
+
+uint64_t k_cycle_get_64(void)
+{
+  return uptime_ns() / Z_HOST_NS_PER_CYC;
+}
+
+void k_busy_wait(uint32_t usec_to_wait)
+{
+  auto end = mono_ns() + static_cast<uint64_t>(usec_to_wait) * 1000U;
+
+  while (mono_ns() < end) {
+  }
+}
+
+//
+// threads
+//
+
+k_tid_t k_thread_create(struct k_thread* new_thread, k_thread_stack_t* stack,
+                        size_t stack_size, k_thread_entry_t entry,
+                        void* p1, void* p2, void* p3,
+                        int prio, uint32_t options, k_timeout_t delay)
+{
+  ARG_UNUSED(stack);
+
+  auto t = new_thread;
+
+  lock();
+
+  init_thread(t, "", prio);
+  t->generation++;
+  t->stack_size = stack_size;
+  t->entry = entry;
+  t->p1 = p1;
+  t->p2 = p2;
+  t->p3 = p3;
+  t->options = options;
+
+  if (!K_TIMEOUT_EQ(delay, K_FOREVER)) {
+    t->state |= thread_started;
+    if (!K_TIMEOUT_EQ(delay, K_NO_WAIT)) {
+      t->start_ticks = MAX(deadline_ticks(delay), 1);
+    }
+  }
+
+  list_add(t);
+
+  pthread_attr_t attr;
+  pthread_attr_init(&attr);
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+  int rc = pthread_create(&t->pthread, &attr, thread_main,
+                          new start_info{ t, t->generation });
+  __ASSERT(rc == 0, "can not create thread (%d)", rc);
+  (void)rc;
+
+  pthread_attr_destroy(&attr);
+
+  unlock();
+
+  return t;
+}
+
+int z_host_thread_define(struct k_thread* new_thread, k_thread_stack_t* stack,
+                         size_t stack_size, k_thread_entry_t entry,
+                         void* p1, void* p2, void* p3,
+                         int prio, uint32_t options, int32_t delay)
+{
+  k_thread_create(new_thread, stack, stack_size, entry, p1, p2, p3,
+                  prio, options,
+                  delay == SYS_FOREVER_MS ? K_FOREVER : K_MSEC(delay));
+
+  return 0;
+}
+
+void k_thread_start(k_tid_t thread)
+{
+  lock();
+  thread->state |= thread_started;
+  wake_all(&thread->wait_q);
+  unlock();
+}
+
+void k_thread_abort(k_tid_t thread)
+{
+  if (thread == nullptr) {
+    return;
+  }
+
+  bool self = (thread == t_self.thread);
+
+  pthread_mutex_lock(&g_lock);
+
+  if ((thread->state & thread_dead) != 0) {
+    pthread_mutex_unlock(&g_lock);
+    return;
+  }
+
+  mark_dead(thread);
+
+  pthread_mutex_unlock(&g_lock);
+
+  if (self) {
+    if (t_self.created) {
+      longjmp(t_self.exit, 1);
+    }
+
+    // there is nothing to unwind to for an adopted thread
+    while (true) {
+      pause();
+    }
+  }
+}
+
+int k_thread_join(struct k_thread* thread, k_timeout_t timeout)
+{
+  if (thread == current()) {
+    return -EDEADLK;
+  }
+
+  lock();
+
+  bool dead = wait(&thread->wait_q, timeout, [thread] {
+    return (thread->state & thread_dead) != 0;
+  });
+
+  unlock();
+
+  return dead ? 0 : timeout_error(timeout);
+}
+
+void k_thread_suspend(k_tid_t thread)
+{
+  lock();
+
+  thread->state |= thread_suspended;
+
+  if (thread == current()) {
+    wait(&thread->wait_q, K_FOREVER, [thread] {
+      return (thread->state & thread_suspended) == 0;
+    });
+  }
+
+  unlock();
+}
+
+void k_thread_resume(k_tid_t thread)
+{
+  lock();
+  thread->state &= ~thread_suspended;
+  wake_all(&thread->wait_q);
+  unlock();
+}
+
+int k_thread_priority_get(k_tid_t thread)
+{
+  lock();
+  int prio = thread->prio;
+  unlock();
+
+  return prio;
+}
+
+void k_thread_priority_set(k_tid_t thread, int prio)
+{
+  lock();
+  thread->prio = prio;
+  unlock();
+}
+
+int k_thread_name_set(k_tid_t thread, const char* str)
+{
+  if (thread == nullptr) {
+    thread = current();
+  }
+
+  lock();
+  strncpy(thread->name, str, sizeof(thread->name) - 1);
+  thread->name[sizeof(thread->name) - 1] = '\0';
+  unlock();
+
+  return 0;
+}
+
+const char* k_thread_name_get(k_tid_t thread)
+{
+  return thread->name;
+}
+
+void k_thread_foreach(k_thread_user_cb_t user_cb, void* user_data)
+{
+  // the callback is called without locks held, so it may use the
+  // kernel, threads are only removed from the list when they die
+  constexpr size_t max_threads = 256;
+  struct k_thread* threads[max_threads];
+  size_t n = 0;
+
+  (void)current();
+
+  pthread_mutex_lock(&g_thread_list_lock);
+  for (auto t = g_thread_list; t != nullptr && n < max_threads; t = t->next_thread) {
+    threads[n++] = t;
+  }
+  pthread_mutex_unlock(&g_thread_list_lock);
+
+  for (size_t i = 0; i < n; ++i) {
+    user_cb(threads[i], user_data);
+  }
+}
+
+k_tid_t k_current_get(void)
+{
+  return current();
+}
+
+int k_thread_runtime_stats_get(k_tid_t thread,
+                               k_thread_runtime_stats_t* stats)
+{
+  if (thread == nullptr || stats == nullptr) {
+    return -EINVAL;
+  }
+
+  clockid_t clock;
+  int rc = -EINVAL;
+
+  lock();
+
+  if ((thread->state & thread_idle) != 0) {
+    stats->execution_cycles = 0;
+    rc = 0;
+  } else if ((thread->state & thread_dead) == 0
+      && pthread_getcpuclockid(thread->pthread, &clock) == 0)
+  {
+    timespec ts;
+    clock_gettime(clock, &ts);
+    stats->execution_cycles = k_ns_to_cyc_ceil64(
+      static_cast<uint64_t>(ts.tv_sec) * 1000000000U
+      + static_cast<uint64_t>(ts.tv_nsec));
+    rc = 0;
+  }
+
+  unlock();
+
+  return rc;
+}
+
+int k_thread_stack_space_get(const struct k_thread* thread,
+                             size_t* unused_ptr)
+{
+  if (thread == nullptr || unused_ptr == nullptr) {
+    return -EINVAL;
+  }
+
+  if (thread != current()) {
+    return -ENOTSUP;
+  }
+
+  pthread_attr_t attr;
+  void* stack_addr = nullptr;
+  size_t stack_size = 0;
+
+  if (pthread_getattr_np(pthread_self(), &attr) != 0) {
+    return -EINVAL;
+  }
+  pthread_attr_getstack(&attr, &stack_addr, &stack_size);
+  pthread_attr_destroy(&attr);
+
+  // the stack grows down towards stack_addr
+  char marker;
+  size_t unused = static_cast<size_t>(&marker - static_cast<char*>(stack_addr));
+
+  // the pthread stack of a created thread is larger than the stack it
+  // was created with, report no more unused space than that one has
+  if (thread->stack_size > 0) {
+    unused = MIN(unused, thread->stack_size);
+  }
+
+  *unused_ptr = unused;
+
+  return 0;
+}
+
+int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t* stats)
+{
+  if (stats == nullptr) {
+    return -EINVAL;
+  }
+
+  timespec ts;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  stats->execution_cycles = k_ns_to_cyc_ceil64(
+    static_cast<uint64_t>(ts.tv_sec) * 1000000000U
+    + static_cast<uint64_t>(ts.tv_nsec));
+
+  return 0;
+}
+
+static k_ticks_t sleep_ticks(k_timeout_t timeout)
+{
+  if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+    k_yield();
+    return 0;
+  }
+
+  auto t = current();
+  bool forever = K_TIMEOUT_EQ(timeout, K_FOREVER);
+  k_ticks_t end = forever ? 0 : deadline_ticks(timeout);
+
+  lock();
+
+  t->state &= ~thread_woken;
+  t->state |= thread_sleeping;
+
+  bool woken = wait(&t->wait_q, timeout, [t] {
+    return (t->state & thread_woken) != 0;
+  });
+
+  t->state &= ~(thread_sleeping | thread_woken);
+
+  unlock();
+
+  if (!woken) {
+    return 0;
+  }
+
+  if (forever) {
+    return K_TICKS_FOREVER;
+  }
+
+  return MAX(end - uptime_ticks(), 0);
+}
+
+int32_t k_sleep(k_timeout_t timeout)
+{
+  auto ticks = sleep_ticks(timeout);
+
+  if (ticks == K_TICKS_FOREVER) {
+    return K_TICKS_FOREVER;
+  }
+
+  return static_cast<int32_t>(k_ticks_to_ms_ceil64(static_cast<uint64_t>(ticks)));
+}
+
+int32_t k_msleep(int32_t ms)
+{
+  return k_sleep(K_MSEC(MAX(ms, 0)));
+}
+
+int32_t k_usleep(int32_t us)
+{
+  auto ticks = sleep_ticks(K_USEC(MAX(us, 0)));
+
+  return static_cast<int32_t>(k_ticks_to_us_floor64(static_cast<uint64_t>(ticks)));
+}
+
+void k_wakeup(k_tid_t thread)
+{
+  lock();
+
+  if ((thread->state & thread_sleeping) != 0) {
+    thread->state |= thread_woken;
+  }
+
+  // also ends a start delay
+  thread->start_ticks = 0;
+
+  wake_all(&thread->wait_q);
+
+  unlock();
+}
+
+void k_yield(void)
+{
+  lock();
+  unlock();
+
+  sched_yield();
+}
+
+bool k_is_in_isr(void)
+{
+  return t_self.in_isr;
+}
+
+void k_sched_lock(void)
+{
+}
+
+void k_sched_unlock(void)
+{
+}
+
+//
+// spinlocks
+//
+
+k_spinlock_key_t k_spin_lock(struct k_spinlock* l)
+{
+  while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE) != 0) {
+    while (__atomic_load_n(&l->locked, __ATOMIC_RELAXED) != 0) {
+      sched_yield();
+    }
+  }
+
+  return k_spinlock_key_t{ 0 };
+}
+
+void k_spin_unlock(struct k_spinlock* l, k_spinlock_key_t key)
+{
+  ARG_UNUSED(key);
+
+  __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+}
+
+//
+// semaphores
+//
+
+int k_sem_init(struct k_sem* sem, unsigned int initial_count,
+               unsigned int limit)
+{
+  if (limit == 0 || initial_count > limit) {
+    return -EINVAL;
+  }
+
+  init_wait_q(&sem->wait_q);
+  sem->count = initial_count;
+  sem->limit = limit;
+  sem->resets = 0;
+
+  return 0;
+}
+
+int k_sem_take(struct k_sem* sem, k_timeout_t timeout)
+{
+  lock();
+
+  auto resets = sem->resets;
+  bool ready = wait(&sem->wait_q, timeout, [sem, resets] {
+    return sem->count > 0 || sem->resets != resets;
+  });
+
+  int rc;
+  if (ready && sem->resets == resets) {
+    sem->count--;
+    rc = 0;
+  } else if (ready) {
+    rc = -EAGAIN;
+  } else {
+    rc = timeout_error(timeout);
+  }
+
+  unlock();
+
+  return rc;
+}
+
+void k_sem_give(struct k_sem* sem)
+{
+  lock();
+
+  if (sem->count < sem->limit) {
+    sem->count++;
+  }
+
+  wake_all(&sem->wait_q);
+
+  unlock();
+}
+
+void k_sem_reset(struct k_sem* sem)
+{
+  lock();
+
+  sem->count = 0;
+  sem->resets++;
+  wake_all(&sem->wait_q);
+
+  unlock();
+}
+
+unsigned int k_sem_count_get(struct k_sem* sem)
+{
+  lock();
+  auto count = sem->count;
+  unlock();
+
+  return count;
+}
+
+//
+// mutexes
+//
+
+int k_mutex_init(struct k_mutex* mutex)
+{
+  init_wait_q(&mutex->wait_q);
+  mutex->owner = nullptr;
+  mutex->lock_count = 0;
+
+  return 0;
+}
+
+int k_mutex_lock(struct k_mutex* mutex, k_timeout_t timeout)
+{
+  lock();
+  int rc = mutex_lock_locked(mutex, timeout);
+  unlock();
+
+  return rc;
+}
+
+int k_mutex_unlock(struct k_mutex* mutex)
+{
+  lock();
+  int rc = mutex_unlock_locked(mutex);
+  unlock();
+
+  return rc;
+}
+
+//
+// condition variables
+//
+
+int k_condvar_init(struct k_condvar* condvar)
+{
+  init_wait_q(&condvar->wait_q);
+  condvar->head = nullptr;
+  condvar->tail = nullptr;
+
+  return 0;
+}
+
+int k_condvar_signal(struct k_condvar* condvar)
+{
+  lock();
+
+  auto t = condvar->head;
+  if (t != nullptr) {
+    condvar_remove(condvar, t);
+    wake_all(&condvar->wait_q);
+  }
+
+  unlock();
+
+  return 0;
+}
+
+int k_condvar_broadcast(struct k_condvar* condvar)
+{
+  int woken = 0;
+
+  lock();
+
+  while (condvar->head != nullptr) {
+    condvar_remove(condvar, condvar->head);
+    woken++;
+  }
+
+  wake_all(&condvar->wait_q);
+
+  unlock();
+
+  return woken;
+}
+
+int k_condvar_wait(struct k_condvar* condvar, struct k_mutex* mutex,
+                   k_timeout_t timeout)
+{
+  auto t = current();
+
+  lock();
+
+  t->condvar = condvar;
+  t->condvar_next = nullptr;
+  if (condvar->tail == nullptr) {
+    condvar->head = t;
+  } else {
+    condvar->tail->condvar_next = t;
+  }
+  condvar->tail = t;
+
+  (void)mutex_unlock_locked(mutex);
+
+  bool signaled = wait(&condvar->wait_q, timeout, [t] {
+    return t->condvar == nullptr;
+  });
+
+  if (!signaled) {
+    condvar_remove(condvar, t);
+  }
+
+  (void)mutex_lock_locked(mutex, K_FOREVER);
+
+  unlock();
+
+  return signaled ? 0 : -EAGAIN;
+}
+
+//
+// queues
+//
+
+void k_queue_init(struct k_queue* queue)
+{
+  init_wait_q(&queue->wait_q);
+  queue->head = nullptr;
+  queue->tail = nullptr;
+  queue->waiters = 0;
+  queue->cancels = 0;
+}
+
+void k_queue_cancel_wait(struct k_queue* queue)
+{
+  lock();
+
+  if (queue->cancels < queue->waiters) {
+    queue->cancels++;
+    wake_all(&queue->wait_q);
+  }
+
+  unlock();
+}
+
+void k_queue_append(struct k_queue* queue, void* data)
+{
+  lock();
+  queue_insert_locked(queue, queue->tail, data);
+  unlock();
+}
+
+void k_queue_prepend(struct k_queue* queue, void* data)
+{
+  lock();
+  queue_insert_locked(queue, nullptr, data);
+  unlock();
+}
+
+void k_queue_insert(struct k_queue* queue, void* prev, void* data)
+{
+  lock();
+  queue_insert_locked(queue, prev, data);
+  unlock();
+}
+
+int k_queue_append_list(struct k_queue* queue, void* head, void* tail)
+{
+  if (head == nullptr || tail == nullptr) {
+    return -EINVAL;
+  }
+
+  lock();
+
+  queue_link(tail) = nullptr;
+  if (queue->tail == nullptr) {
+    queue->head = head;
+  } else {
+    queue_link(queue->tail) = head;
+  }
+  queue->tail = tail;
+
+  wake_all(&queue->wait_q);
+
+  unlock();
+
+  return 0;
+}
+
+int k_queue_merge_slist(struct k_queue* queue, sys_slist_t* list)
+{
+  if (sys_slist_is_empty(list)) {
+    return -EINVAL;
+  }
+
+  int rc = k_queue_append_list(queue, list->head, list->tail);
+  sys_slist_init(list);
+
+  return rc;
+}
+
+void* k_queue_get(struct k_queue* queue, k_timeout_t timeout)
+{
+  void* data = nullptr;
+
+  lock();
+
+  queue->waiters++;
+
+  bool ready = wait(&queue->wait_q, timeout, [queue] {
+    return queue->cancels > 0 || queue->head != nullptr;
+  });
+
+  queue->waiters--;
+
+  if (ready) {
+    if (queue->cancels > 0) {
+      queue->cancels--;
+    } else {
+      data = queue->head;
+      queue->head = queue_link(data);
+      if (queue->head == nullptr) {
+        queue->tail = nullptr;
+      }
+    }
+  }
+
+  // a cancel meant for a waiter that timed out is dropped
+  if (queue->waiters == 0) {
+    queue->cancels = 0;
+  }
+
+  unlock();
+
+  return data;
+}
+
+bool k_queue_remove(struct k_queue* queue, void* data)
+{
+  bool found = false;
+
+  lock();
+
+  void* prev = nullptr;
+  for (auto n = queue->head; n != nullptr; n = queue_link(n)) {
+    if (n == data) {
+      if (prev == nullptr) {
+        queue->head = queue_link(n);
+      } else {
+        queue_link(prev) = queue_link(n);
+      }
+      if (queue->tail == n) {
+        queue->tail = prev;
+      }
+      found = true;
+      break;
+    }
+    prev = n;
+  }
+
+  unlock();
+
+  return found;
+}
+
+int k_queue_is_empty(struct k_queue* queue)
+{
+  lock();
+  bool empty = queue->head == nullptr;
+  unlock();
+
+  return empty ? 1 : 0;
+}
+
+void* k_queue_peek_head(struct k_queue* queue)
+{
+  lock();
+  auto data = queue->head;
+  unlock();
+
+  return data;
+}
+
+void* k_queue_peek_tail(struct k_queue* queue)
+{
+  lock();
+  auto data = queue->tail;
+  unlock();
+
+  return data;
+}
+
+//
+// stacks
+//
+
+void k_stack_init(struct k_stack* stack, stack_data_t* buffer,
+                  uint32_t num_entries)
+{
+  init_wait_q(&stack->wait_q);
+  stack->base = buffer;
+  stack->next = buffer;
+  stack->top = buffer + num_entries;
+}
+
+int k_stack_push(struct k_stack* stack, stack_data_t data)
+{
+  int rc = 0;
+
+  lock();
+
+  if (stack->next == stack->top) {
+    rc = -ENOMEM;
+  } else {
+    *stack->next++ = data;
+    wake_all(&stack->wait_q);
+  }
+
+  unlock();
+
+  return rc;
+}
+
+int k_stack_pop(struct k_stack* stack, stack_data_t* data,
+                k_timeout_t timeout)
+{
+  int rc = 0;
+
+  lock();
+
+  if (wait(&stack->wait_q, timeout, [stack] { return stack->next > stack->base; })) {
+    *data = *--stack->next;
+  } else {
+    rc = timeout_error(timeout);
+  }
+
+  unlock();
+
+  return rc;
+}
+
+//
+// message queues
+//
+
+void k_msgq_init(struct k_msgq* msgq, char* buffer, size_t msg_size,
+                 uint32_t max_msgs)
+{
+  init_wait_q(&msgq->wait_q);
+  msgq->msg_size = msg_size;
+  msgq->max_msgs = max_msgs;
+  msgq->buffer_start = buffer;
+  msgq->buffer_end = buffer + max_msgs * msg_size;
+  msgq->read_ptr = buffer;
+  msgq->write_ptr = buffer;
+  msgq->used_msgs = 0;
+}
+
+int k_msgq_put(struct k_msgq* msgq, const void* data, k_timeout_t timeout)
+{
+  int rc = 0;
+
+  lock();
+
+  if (wait(&msgq->wait_q, timeout, [msgq] { return msgq->used_msgs < msgq->max_msgs; })) {
+    memcpy(msgq->write_ptr, data, msgq->msg_size);
+    msgq->write_ptr += msgq->msg_size;
+    if (msgq->write_ptr == msgq->buffer_end) {
+      msgq->write_ptr = msgq->buffer_start;
+    }
+    msgq->used_msgs++;
+    wake_all(&msgq->wait_q);
+  } else {
+    rc = K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? -ENOMSG : -EAGAIN;
+  }
+
+  unlock();
+
+  return rc;
+}
+
+int k_msgq_get(struct k_msgq* msgq, void* data, k_timeout_t timeout)
+{
+  int rc = 0;
+
+  lock();
+
+  if (wait(&msgq->wait_q, timeout, [msgq] { return msgq->used_msgs > 0; })) {
+    memcpy(data, msgq->read_ptr, msgq->msg_size);
+    msgq->read_ptr += msgq->msg_size;
+    if (msgq->read_ptr == msgq->buffer_end) {
+      msgq->read_ptr = msgq->buffer_start;
+    }
+    msgq->used_msgs--;
+    wake_all(&msgq->wait_q);
+  } else {
+    rc = K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? -ENOMSG : -EAGAIN;
+  }
+
+  unlock();
+
+  return rc;
+}
+
+int k_msgq_peek(struct k_msgq* msgq, void* data)
+{
+  int rc = 0;
+
+  lock();
+
+  if (msgq->used_msgs > 0) {
+    memcpy(data, msgq->read_ptr, msgq->msg_size);
+  } else {
+    rc = -ENOMSG;
+  }
+
+  unlock();
+
+  return rc;
+}
+
+void k_msgq_purge(struct k_msgq* msgq)
+{
+  lock();
+
+  msgq->read_ptr = msgq->write_ptr;
+  msgq->used_msgs = 0;
+  wake_all(&msgq->wait_q);
+
+  unlock();
+}
+
+uint32_t k_msgq_num_free_get(struct k_msgq* msgq)
+{
+  lock();
+  auto n = msgq->max_msgs - msgq->used_msgs;
+  unlock();
+
+  return n;
+}
+
+uint32_t k_msgq_num_used_get(struct k_msgq* msgq)
+{
+  lock();
+  auto n = msgq->used_msgs;
+  unlock();
+
+  return n;
+}
+
+//
+// timers
+//
+
+void k_timer_init(struct k_timer* timer, k_timer_expiry_t expiry_fn,
+                  k_timer_stop_t stop_fn)
+{
+  init_wait_q(&timer->wait_q);
+  timer->expiry_fn = expiry_fn;
+  timer->stop_fn = stop_fn;
+  timer->next = nullptr;
+  timer->expires = 0;
+  timer->period = 0;
+  timer->status = 0;
+  timer->active = false;
+  timer->user_data = nullptr;
+}
+
+void k_timer_start(struct k_timer* timer, k_timeout_t duration,
+                   k_timeout_t period)
+{
+  if (K_TIMEOUT_EQ(duration, K_FOREVER)) {
+    return;
+  }
+
+  lock();
+
+  if (timer->active) {
+    timer_remove(timer);
+  }
+
+  timer->expires = deadline_ticks(duration);
+  timer->period = period.ticks > 0 ? period.ticks : 0;
+  timer->status = 0;
+  timer->active = true;
+
+  timer_insert(timer);
+  start_timer_thread();
+
+  unlock();
+}
+
+void k_timer_stop(struct k_timer* timer)
+{
+  lock();
+
+  bool was_active = timer->active;
+  if (was_active) {
+    timer_remove(timer);
+    timer->active = false;
+    wake_all(&timer->wait_q);
+  }
+
+  unlock();
+
+  if (was_active && timer->stop_fn != nullptr) {
+    timer->stop_fn(timer);
+  }
+
+  // on a single CPU the expiry function can not be running when a
+  // thread stops the timer, give the threads here the same guarantee
+  if (!t_self.in_isr) {
+    lock();
+    while (g_timer_running == timer) {
+      pthread_cond_wait(&g_timer_done_cond, &g_lock);
+    }
+    unlock();
+  }
+}
+
+uint32_t k_timer_status_get(struct k_timer* timer)
+{
+  lock();
+  auto status = timer->status;
+  timer->status = 0;
+  unlock();
+
+  return status;
+}
+
+uint32_t k_timer_status_sync(struct k_timer* timer)
+{
+  lock();
+
+  wait(&timer->wait_q, K_FOREVER, [timer] {
+    return timer->status > 0 || !timer->active;
+  });
+
+  auto status = timer->status;
+  timer->status = 0;
+
+  unlock();
+
+  return status;
+}
+
+k_ticks_t k_timer_expires_ticks(const struct k_timer* timer)
+{
+  lock();
+  auto expires = timer->active ? timer->expires : 0;
+  unlock();
+
+  return expires;
+}
+
+k_ticks_t k_timer_remaining_ticks(const struct k_timer* timer)
+{
+  lock();
+  auto remaining = timer->active ? MAX(timer->expires - uptime_ticks(), 0) : 0;
+  unlock();
+
+  return remaining;
+}
+
+//
+// heaps
+//
+
+void k_heap_init(struct k_heap* h, void* mem, size_t bytes)
+{
+  init_wait_q(&h->wait_q);
+  heap_init_locked(h, mem, bytes);
+}
+
+void* k_heap_alloc(struct k_heap* h, size_t bytes, k_timeout_t timeout)
+{
+  return k_heap_aligned_alloc(h, sizeof(void*), bytes, timeout);
+}
+
+void* k_heap_aligned_alloc(struct k_heap* h, size_t align, size_t bytes,
+                           k_timeout_t timeout)
+{
+  void* mem = nullptr;
+
+  __ASSERT((align & (align - 1)) == 0, "align must be a power of two");
+
+  lock();
+
+  if (!h->initialized) {
+    heap_init_locked(h, h->mem, h->size);
+  }
+
+  wait(&h->wait_q, timeout, [h, align, bytes, &mem] {
+    mem = heap_alloc_locked(h, align, bytes);
+    return mem != nullptr;
+  });
+
+  unlock();
+
+  return mem;
+}
+
+void k_heap_free(struct k_heap* h, void* mem)
+{
+  if (mem == nullptr) {
+    return;
+  }
+
+  lock();
+  heap_free_locked(h, mem);
+  wake_all(&h->wait_q);
+  unlock();
+}
+
+//
+// memory slabs
+//
+
+int k_mem_slab_init(struct k_mem_slab* slab, void* buffer,
+                    size_t block_size, uint32_t num_blocks)
+{
+  if (block_size < sizeof(void*) || (block_size % sizeof(void*)) != 0
+      || (reinterpret_cast<uintptr_t>(buffer) % sizeof(void*)) != 0)
+  {
+    return -EINVAL;
+  }
+
+  init_wait_q(&slab->wait_q);
+  mem_slab_init_locked(slab, buffer, block_size, num_blocks);
+
+  return 0;
+}
+
+int k_mem_slab_alloc(struct k_mem_slab* slab, void** mem,
+                     k_timeout_t timeout)
+{
+  int rc = 0;
+
+  lock();
+
+  if (!slab->initialized) {
+    mem_slab_init_locked(slab, slab->buffer, slab->block_size,
+                         slab->num_blocks);
+  }
+
+  if (wait(&slab->wait_q, timeout, [slab] { return slab->free_list != nullptr; })) {
+    *mem = slab->free_list;
+    slab->free_list = *reinterpret_cast<char**>(slab->free_list);
+    slab->num_used++;
+  } else {
+    *mem = nullptr;
+    rc = K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? -ENOMEM : -EAGAIN;
+  }
+
+  unlock();
+
+  return rc;
+}
+
+void k_mem_slab_free(struct k_mem_slab* slab, void** mem)
+{
+  lock();
+
+  auto block = static_cast<char*>(*mem);
+  *reinterpret_cast<char**>(block) = slab->free_list;
+  slab->free_list = block;
+  slab->num_used--;
+
+  wake_all(&slab->wait_q);
+
+  unlock();
+}
+
+uint32_t k_mem_slab_num_used_get(struct k_mem_slab* slab)
+{
+  lock();
+  auto n = slab->num_used;
+  unlock();
+
+  return n;
+}
+
+uint32_t k_mem_slab_num_free_get(struct k_mem_slab* slab)
+{
+  lock();
+  auto n = slab->num_blocks - slab->num_used;
+  unlock();
+
+  return n;
+}
+
+//
+// work queues
+//
+
+struct k_work_q k_sys_work_q;
+
+void k_work_init(struct k_work* work, k_work_handler_t handler)
+{
+  work->node.next = nullptr;
+  work->handler = handler;
+  work->queue = nullptr;
+  work->flags = 0;
+}
+
+int k_work_busy_get(const struct k_work* work)
+{
+  lock();
+  auto flags = work->flags;
+  unlock();
+
+  return static_cast<int>(flags);
+}
+
+bool k_work_is_pending(const struct k_work* work)
+{
+  return k_work_busy_get(work) != 0;
+}
+
+int k_work_submit_to_queue(struct k_work_q* queue, struct k_work* work)
+{
+  if (queue == &k_sys_work_q) {
+    pthread_once(&g_sys_work_q_once, start_sys_work_q);
+  }
+
+  int rc;
+
+  lock();
+
+  if ((work->flags & K_WORK_CANCELING) != 0) {
+    rc = -EBUSY;
+  } else if ((work->flags & K_WORK_QUEUED) != 0) {
+    rc = 0;
+  } else {
+    rc = (work->flags & K_WORK_RUNNING) != 0 ? 2 : 1;
+    work->flags |= K_WORK_QUEUED;
+    work->queue = queue;
+    sys_slist_append(&queue->pending, &work->node);
+    wake_all(&queue->wait_q);
+  }
+
+  unlock();
+
+  return rc;
+}
+
+int k_work_submit(struct k_work* work)
+{
+  return k_work_submit_to_queue(&k_sys_work_q, work);
+}
+
+int k_work_cancel(struct k_work* work)
+{
+  lock();
+
+  if ((work->flags & K_WORK_QUEUED) != 0) {
+    sys_slist_find_and_remove(&work->queue->pending, &work->node);
+    work->flags &= ~K_WORK_QUEUED;
+  }
+
+  auto flags = work->flags;
+
+  unlock();
+
+  return static_cast<int>(flags);
+}
+
+bool k_work_cancel_sync(struct k_work* work, struct k_work_sync* sync)
+{
+  ARG_UNUSED(sync);
+
+  lock();
+
+  bool pending = work->flags != 0;
+
+  if ((work->flags & K_WORK_QUEUED) != 0) {
+    sys_slist_find_and_remove(&work->queue->pending, &work->node);
+    work->flags &= ~K_WORK_QUEUED;
+  }
+
+  work->flags |= K_WORK_CANCELING;
+  work_wait_idle_locked(work, K_WORK_RUNNING);
+  work->flags &= ~K_WORK_CANCELING;
+
+  unlock();
+
+  return pending;
+}
+
+bool k_work_flush(struct k_work* work, struct k_work_sync* sync)
+{
+  ARG_UNUSED(sync);
+
+  lock();
+
+  bool pending = (work->flags & (K_WORK_QUEUED | K_WORK_RUNNING)) != 0;
+  work_wait_idle_locked(work, K_WORK_QUEUED | K_WORK_RUNNING);
+
+  unlock();
+
+  return pending;
+}
+
+void k_work_queue_init(struct k_work_q* queue)
+{
+  init_wait_q(&queue->wait_q);
+  sys_slist_init(&queue->pending);
+  queue->started = false;
+}
+
+void k_work_queue_start(struct k_work_q* queue, k_thread_stack_t* stack,
+                        size_t stack_size, int prio,
+                        const struct k_work_queue_config* cfg)
+{
+  k_work_queue_init(queue);
+  queue->started = true;
+
+  k_thread_create(&queue->thread, stack, stack_size, work_q_main,
+                  queue, nullptr, nullptr, prio, 0, K_FOREVER);
+
+  if (cfg != nullptr && cfg->name != nullptr) {
+    k_thread_name_set(&queue->thread, cfg->name);
+  }
+
+  k_thread_start(&queue->thread);
+}
+
+//
+// console and asserts
+//
+
+void printk(const char* fmt, ...)
+{
+  va_list ap;
+  va_start(ap, fmt);
+  vprintf(fmt, ap);
+  va_end(ap);
+}
+
+void z_host_assert_fail(const char* file, int line, const char* expr,
+                        const char* fmt, ...)
+{
+  fprintf(stderr, "ASSERTION FAIL [%s] @ %s:%d\n", expr, file, line);
+
+  if (fmt != nullptr && fmt[0] != '\0') {
+    va_list ap;
+    va_start(ap, fmt);
+    fputc('\t', stderr);
+    vfprintf(stderr, fmt, ap);
+    fputc('\n', stderr);
+    va_end(ap);
+  }
+
+  fflush(stdout);
+  abort();
+}
+
+} // extern "C"
@@ -0,0 +1,382 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <zephyr/sys/rb.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+constexpr uint8_t left = 0;
+constexpr uint8_t right = 1;
+
+constexpr uint8_t other(uint8_t side) noexcept
+{
+  return static_cast<uint8_t>(1U - side);
+}
+
+rbnode* get_child(rbnode* n, uint8_t side) noexcept
+{
+  return z_rb_child(n, side);
+}
+
+void set_child(rbnode* n, uint8_t side, rbnode* c) noexcept
+{
+  if (side == right) {
+    auto color = reinterpret_cast<uintptr_t>(n->children[right]) & 1U;
+    n->children[right] = reinterpret_cast<rbnode*>(
+      reinterpret_cast<uintptr_t>(c) | color);
+  } else {
+    n->children[left] = c;
+  }
+}
+
+bool is_red(rbnode* n) noexcept
+{
+  return n != nullptr
+    && (reinterpret_cast<uintptr_t>(n->children[right]) & 1U) != 0;
+}
+
+bool is_black(rbnode* n) noexcept
+{
+  return !is_red(n);
+}
+
+void set_red(rbnode* n, bool red) noexcept
+{
+  auto c = reinterpret_cast<uintptr_t>(n->children[right]) & ~uintptr_t{1};
+  n->children[right] = reinterpret_cast<rbnode*>(c | (red ? 1U : 0U));
+}
+
+uint8_t side_of(rbnode* parent, rbnode* child) noexcept
+{
+  return get_child(parent, left) == child ? left : right;
+}
+
+// make the link to old, from its parent or the root, point to n
+void replace_child(rbtree* tree, rbnode* parent, rbnode* old, rbnode* n) noexcept
+{
+  if (parent == nullptr) {
+    tree->root = n;
+  } else {
+    set_child(parent, side_of(parent, old), n);
+  }
+}
+
+// rotate n down to side, its child on the other side takes its place
+rbnode* rotate(rbtree* tree, rbnode* parent, rbnode* n, uint8_t side) noexcept
+{
+  auto c = get_child(n, other(side));
+
+  set_child(n, other(side), get_child(c, side));
+  set_child(c, side, n);
+  replace_child(tree, parent, n, c);
+
+  return c;
+}
+
+// fill stack with the path from the root to target, nodes that compare
+// equal can be in both subtrees
+bool find_path(rbtree* tree, rbnode* target, rbnode* n,
+               rbnode** stack, int& sz) noexcept
+{
+  if (n == nullptr) {
+    return false;
+  }
+
+  stack[sz++] = n;
+
+  if (n == target) {
+    return true;
+  }
+
+  if (tree->lessthan_fn(target, n)) {
+    if (find_path(tree, target, get_child(n, left), stack, sz)) {
+      return true;
+    }
+  } else if (tree->lessthan_fn(n, target)) {
+    if (find_path(tree, target, get_child(n, right), stack, sz)) {
+      return true;
+    }
+  } else if (find_path(tree, target, get_child(n, left), stack, sz)
+             || find_path(tree, target, get_child(n, right), stack, sz))
+  {
+    return true;
+  }
+
+  sz--;
+  return false;
+}
+
+void fix_insert(rbtree* tree, rbnode** stack, int i) noexcept
+{
+  while (i > 0) {
+    auto n = stack[i];
+    auto p = stack[i - 1];
+
+    if (is_black(p)) {
+      break;
+    }
+
+    // a red node is never the root, so the grandparent exists
+    auto g = stack[i - 2];
+    auto pside = side_of(g, p);
+    auto u = get_child(g, other(pside));
+
+    if (is_red(u)) {
+      set_red(p, false);
+      set_red(u, false);
+      set_red(g, true);
+      i -= 2;
+      continue;
+    }
+
+    if (side_of(p, n) != pside) {
+      rotate(tree, g, p, pside);
+      p = n;
+    }
+
+    rotate(tree, i >= 3 ? stack[i - 3] : nullptr, g, other(pside));
+    set_red(p, false);
+    set_red(g, true);
+    break;
+  }
+
+  set_red(tree->root, false);
+}
+
+// let node z at stack[zi] and its successor s at stack[si] trade places
+void swap_nodes(rbtree* tree, rbnode** stack, int zi, int si) noexcept
+{
+  auto z = stack[zi];
+  auto s = stack[si];
+  auto zp = zi > 0 ? stack[zi - 1] : nullptr;
+  auto zl = get_child(z, left);
+  auto zr = get_child(z, right);
+  auto sr = get_child(s, right);
+  bool z_red = is_red(z);
+  bool s_red = is_red(s);
+
+  replace_child(tree, zp, z, s);
+
+  if (si == zi + 1) {
+    set_child(s, right, z);
+  } else {
+    set_child(stack[si - 1], left, z);
+    set_child(s, right, zr);
+  }
+
+  set_child(s, left, zl);
+  set_child(z, left, nullptr);
+  set_child(z, right, sr);
+
+  set_red(s, z_red);
+  set_red(z, s_red);
+
+  stack[zi] = s;
+  stack[si] = z;
+}
+
+// x, which may be nullptr, is one black short, stack[pi] is its parent
+void fix_remove(rbtree* tree, rbnode** stack, int pi, rbnode* x) noexcept
+{
+  while (pi >= 0 && is_black(x)) {
+    auto p = stack[pi];
+    auto side = get_child(p, left) == x ? left : right;
+    auto w = get_child(p, other(side));
+
+    if (is_red(w)) {
+      set_red(w, false);
+      set_red(p, true);
+      rotate(tree, pi > 0 ? stack[pi - 1] : nullptr, p, side);
+      stack[pi] = w;
+      stack[pi + 1] = p;
+      pi++;
+      w = get_child(p, other(side));
+    }
+
+    if (is_black(get_child(w, left)) && is_black(get_child(w, right))) {
+      set_red(w, true);
+      x = p;
+      pi--;
+      continue;
+    }
+
+    if (is_black(get_child(w, other(side)))) {
+      set_red(get_child(w, side), false);
+      set_red(w, true);
+      w = rotate(tree, p, w, other(side));
+    }
+
+    set_red(w, is_red(p));
+    set_red(p, false);
+    set_red(get_child(w, other(side)), false);
+    rotate(tree, pi > 0 ? stack[pi - 1] : nullptr, p, side);
+    x = tree->root;
+    break;
+  }
+
+  if (x != nullptr) {
+    set_red(x, false);
+  }
+}
+
+rbnode* stack_left_limb(rbnode* n, _rb_foreach* f) noexcept
+{
+  if (n == nullptr) {
+    return nullptr;
+  }
+
+  auto top = ++f->top;
+  f->stack[top] = n;
+  f->is_left[top] = 0;
+
+  while ((n = get_child(n, left)) != nullptr) {
+    top = ++f->top;
+    f->stack[top] = n;
+    f->is_left[top] = 1;
+  }
+
+  return f->stack[f->top];
+}
+
+} // namespace
+
+extern "C" {
+
+void rb_insert(rbtree* tree, rbnode* node)
+{
+  node->children[left] = nullptr;
+  node->children[right] = nullptr;
+
+  if (tree->root == nullptr) {
+    tree->root = node;
+    tree->max_depth = 1;
+    return;
+  }
+
+  rbnode* stack[Z_MAX_RBTREE_DEPTH];
+  int sz = 0;
+
+  auto n = tree->root;
+  while (true) {
+    stack[sz++] = n;
+
+    auto side = tree->lessthan_fn(node, n) ? left : right;
+    auto c = get_child(n, side);
+    if (c == nullptr) {
+      set_child(n, side, node);
+      break;
+    }
+    n = c;
+  }
+
+  set_red(node, true);
+  stack[sz++] = node;
+
+  if (sz > tree->max_depth) {
+    tree->max_depth = sz;
+  }
+
+  fix_insert(tree, stack, sz - 1);
+}
+
+void rb_remove(rbtree* tree, rbnode* node)
+{
+  rbnode* stack[Z_MAX_RBTREE_DEPTH];
+  int sz = 0;
+
+  if (!find_path(tree, node, tree->root, stack, sz)) {
+    return;
+  }
+
+  if (get_child(node, left) != nullptr && get_child(node, right) != nullptr) {
+    int zi = sz - 1;
+    auto s = get_child(node, right);
+    stack[sz++] = s;
+    while ((s = get_child(s, left)) != nullptr) {
+      stack[sz++] = s;
+    }
+    swap_nodes(tree, stack, zi, sz - 1);
+  }
+
+  // node is at the top of the stack now and has at most one child
+  auto child = get_child(node, left) != nullptr ?
+    get_child(node, left) : get_child(node, right);
+  bool was_red = is_red(node);
+
+  replace_child(tree, sz > 1 ? stack[sz - 2] : nullptr, node, child);
+
+  node->children[left] = nullptr;
+  node->children[right] = nullptr;
+
+  if (was_red) {
+    return;
+  }
+
+  if (is_red(child)) {
+    set_red(child, false);
+    return;
+  }
+
+  fix_remove(tree, stack, sz - 2, child);
+}
+
+bool rb_contains(rbtree* tree, rbnode* node)
+{
+  rbnode* stack[Z_MAX_RBTREE_DEPTH];
+  int sz = 0;
+
+  return find_path(tree, node, tree->root, stack, sz);
+}
+
+rbnode* z_rb_get_minmax(rbtree* tree, uint8_t side)
+{
+  auto n = tree->root;
+
+  if (n != nullptr) {
+    while (get_child(n, side) != nullptr) {
+      n = get_child(n, side);
+    }
+  }
+
+  return n;
+}
+
+rbnode* z_rb_foreach_next(rbtree* tree, _rb_foreach* f)
+{
+  if (tree->root == nullptr) {
+    return nullptr;
+  }
+
+  // start with the leftmost node
+  if (f->top == -1) {
+    return stack_left_limb(tree->root, f);
+  }
+
+  // the next node is the leftmost node of the right subtree
+  auto n = get_child(f->stack[f->top], right);
+  if (n != nullptr) {
+    return stack_left_limb(n, f);
+  }
+
+  // a left child is followed by its parent
+  if (f->is_left[f->top] != 0) {
+    return f->stack[--f->top];
+  }
+
+  // a right child without right subtree, walk up to the first node
+  // that was reached as a left child, its parent is next
+  while (f->top > 0 && f->is_left[f->top] == 0) {
+    f->top--;
+  }
+
+  f->top--;
+  return f->top >= 0 ? f->stack[f->top] : nullptr;
+}
+
+} // extern "C"
@@ -0,0 +1,137 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <zephyr/sys/ring_buffer.h>
+
+#include <zephyr/kernel.h>
+
+#include <cerrno>
+#include <cstring>
+
+namespace {
+
+//
+// The head, tail and base indexes only grow, the base is the index of
+// the first byte of the buffer and moves on by the buffer size when a
+// tail wraps. A claim never goes past the end of the buffer.
+//
+uint32_t claim(struct ring_buf* buf, int32_t head, int32_t base,
+               uint32_t available, uint8_t** data, uint32_t size) noexcept
+{
+  uint32_t wrap_size = static_cast<uint32_t>(head - base);
+  if (wrap_size >= buf->size) {
+    // the base is not moved on yet
+    wrap_size -= buf->size;
+    base += static_cast<int32_t>(buf->size);
+  }
+  wrap_size = buf->size - wrap_size;
+
+  size = MIN(size, available);
+  size = MIN(size, wrap_size);
+
+  *data = &buf->buffer[head - base];
+
+  return size;
+}
+
+int finish(struct ring_buf* buf, int32_t& head, int32_t& tail, int32_t& base,
+           uint32_t size) noexcept
+{
+  if (size > static_cast<uint32_t>(head - tail)) {
+    return -EINVAL;
+  }
+
+  tail += static_cast<int32_t>(size);
+  head = tail;
+
+  if (static_cast<uint32_t>(tail - base) >= buf->size) {
+    base += static_cast<int32_t>(buf->size);
+  }
+
+  return 0;
+}
+
+} // namespace
+
+extern "C" {
+
+uint32_t ring_buf_put_claim(struct ring_buf* buf, uint8_t** data,
+                            uint32_t size)
+{
+  size = claim(buf, buf->put_head, buf->put_base, ring_buf_space_get(buf),
+               data, size);
+  buf->put_head += static_cast<int32_t>(size);
+
+  return size;
+}
+
+int ring_buf_put_finish(struct ring_buf* buf, uint32_t size)
+{
+  return finish(buf, buf->put_head, buf->put_tail, buf->put_base, size);
+}
+
+uint32_t ring_buf_put(struct ring_buf* buf, const uint8_t* data,
+                      uint32_t size)
+{
+  uint32_t total = 0;
+  uint8_t* dst;
+  uint32_t partial;
+
+  do {
+    partial = ring_buf_put_claim(buf, &dst, size);
+    memcpy(dst, data, partial);
+    total += partial;
+    size -= partial;
+    data += partial;
+  } while (size > 0 && partial > 0);
+
+  int rc = ring_buf_put_finish(buf, total);
+  __ASSERT_NO_MSG(rc == 0);
+  (void)rc;
+
+  return total;
+}
+
+uint32_t ring_buf_get_claim(struct ring_buf* buf, uint8_t** data,
+                            uint32_t size)
+{
+  size = claim(buf, buf->get_head, buf->get_base,
+               static_cast<uint32_t>(buf->put_tail - buf->get_head),
+               data, size);
+  buf->get_head += static_cast<int32_t>(size);
+
+  return size;
+}
+
+int ring_buf_get_finish(struct ring_buf* buf, uint32_t size)
+{
+  return finish(buf, buf->get_head, buf->get_tail, buf->get_base, size);
+}
+
+uint32_t ring_buf_get(struct ring_buf* buf, uint8_t* data, uint32_t size)
+{
+  uint32_t total = 0;
+  uint8_t* src;
+  uint32_t partial;
+
+  do {
+    partial = ring_buf_get_claim(buf, &src, size);
+    if (data != nullptr) {
+      memcpy(data, src, partial);
+      data += partial;
+    }
+    total += partial;
+    size -= partial;
+  } while (size > 0 && partial > 0);
+
+  int rc = ring_buf_get_finish(buf, total);
+  __ASSERT_NO_MSG(rc == 0);
+  (void)rc;
+
+  return total;
+}
+
+} // extern "C"
@@ -0,0 +1,212 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <zephyr/ztest.h>
+
+#include <csetjmp>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+#include <pthread.h>
+
+namespace {
+
+constexpr size_t max_suites = 64;
+constexpr size_t max_tests = 1024;
+
+struct suite_info {
+  const char*             name;
+  ztest_suite_predicate_t predicate;
+  ztest_suite_setup_t     setup;
+  ztest_suite_before_t    before;
+  ztest_suite_after_t     after;
+  ztest_suite_teardown_t  teardown;
+};
+
+struct test_info {
+  const char* suite;
+  const char* name;
+  void (*fn)(void);
+};
+
+// plain arrays, so they are ready before any registration runs
+suite_info g_suites[max_suites];
+size_t g_suite_count;
+test_info g_tests[max_tests];
+size_t g_test_count;
+
+enum test_result : int {
+  result_pass = 1,
+  result_fail,
+  result_skip,
+};
+
+pthread_t g_runner;
+jmp_buf g_test_exit;
+bool g_failed_elsewhere;
+
+[[noreturn]] void end_test(test_result result)
+{
+  longjmp(g_test_exit, result);
+}
+
+test_result run_test(const test_info& test)
+{
+  g_failed_elsewhere = false;
+
+  auto rc = setjmp(g_test_exit);
+  if (rc == 0) {
+    test.fn();
+    rc = result_pass;
+  }
+
+  if (rc == result_pass && __atomic_load_n(&g_failed_elsewhere, __ATOMIC_SEQ_CST)) {
+    rc = result_fail;
+  }
+
+  return static_cast<test_result>(rc);
+}
+
+} // namespace
+
+extern "C" {
+
+int z_host_ztest_register_suite(const char* name,
+                                ztest_suite_predicate_t predicate,
+                                ztest_suite_setup_t setup,
+                                ztest_suite_before_t before,
+                                ztest_suite_after_t after,
+                                ztest_suite_teardown_t teardown)
+{
+  __ASSERT(g_suite_count < max_suites, "too many suites");
+
+  g_suites[g_suite_count++] = { name, predicate, setup, before, after, teardown };
+
+  return 0;
+}
+
+int z_host_ztest_register_test(const char* suite, const char* name,
+                               void (*fn)(void))
+{
+  __ASSERT(g_test_count < max_tests, "too many tests");
+
+  g_tests[g_test_count++] = { suite, name, fn };
+
+  return 0;
+}
+
+void z_host_ztest_fail(const char* file, int line, const char* msg,
+                       const char* fmt, ...)
+{
+  printf("\n    Assertion failed at %s:%d: %s\n", file, line, msg);
+
+  if (fmt != nullptr && fmt[0] != '\0') {
+    va_list ap;
+    va_start(ap, fmt);
+    printf("    ");
+    vprintf(fmt, ap);
+    printf("\n");
+    va_end(ap);
+  }
+
+  ztest_test_fail();
+}
+
+void ztest_test_fail(void)
+{
+  if (pthread_equal(pthread_self(), g_runner)) {
+    end_test(result_fail);
+  }
+
+  __atomic_store_n(&g_failed_elsewhere, true, __ATOMIC_SEQ_CST);
+}
+
+void ztest_test_pass(void)
+{
+  if (pthread_equal(pthread_self(), g_runner)) {
+    end_test(result_pass);
+  }
+}
+
+void ztest_test_skip(void)
+{
+  if (pthread_equal(pthread_self(), g_runner)) {
+    end_test(result_skip);
+  }
+}
+
+} // extern "C"
+
+int main(void)
+{
+  size_t passed = 0;
+  size_t failed = 0;
+  size_t skipped = 0;
+
+  setvbuf(stdout, nullptr, _IOLBF, 0);
+
+  g_runner = pthread_self();
+  (void)k_current_get();
+
+  for (size_t s = 0; s < g_suite_count; ++s) {
+    const auto& suite = g_suites[s];
+
+    if (suite.predicate != nullptr && !suite.predicate(nullptr)) {
+      continue;
+    }
+
+    printf("Running TESTSUITE %s\n", suite.name);
+
+    void* fixture = suite.setup != nullptr ? suite.setup() : nullptr;
+
+    for (size_t t = 0; t < g_test_count; ++t) {
+      const auto& test = g_tests[t];
+
+      if (strcmp(test.suite, suite.name) != 0) {
+        continue;
+      }
+
+      printf("START - %s\n", test.name);
+
+      if (suite.before != nullptr) {
+        suite.before(fixture);
+      }
+
+      auto start = k_uptime_get();
+      auto result = run_test(test);
+      auto ms = k_uptime_get() - start;
+
+      if (suite.after != nullptr) {
+        suite.after(fixture);
+      }
+
+      switch (result) {
+      case result_pass:
+        passed++;
+        printf(" PASS - %s in %lld ms\n", test.name, static_cast<long long>(ms));
+        break;
+      case result_fail:
+        failed++;
+        printf(" FAIL - %s in %lld ms\n", test.name, static_cast<long long>(ms));
+        break;
+      case result_skip:
+        skipped++;
+        printf(" SKIP - %s\n", test.name);
+        break;
+      }
+    }
+
+    if (suite.teardown != nullptr) {
+      suite.teardown(fixture);
+    }
+  }
+
+  printf("SUMMARY: %zu passed, %zu failed, %zu skipped\n",
+         passed, failed, skipped);
+
+  return failed == 0 ? 0 : 1;
+}
@@ -20,20 +20,38 @@
 #include <zpp/result.hpp>
 #include <zpp/atomic_bitset.hpp>
 #include <zpp/atomic_var.hpp>
+#include <zpp/broadcast.hpp>
 #include <zpp/clock.hpp>
 #include <zpp/condition_variable.hpp>
+#include <zpp/counting_sem.hpp>
 #include <zpp/fmt.hpp>
 #include <zpp/fifo.hpp>
 #include <zpp/heap.hpp>
+#include <zpp/intrusive_dlist.hpp>
+#include <zpp/intrusive_rbtree.hpp>
+#include <zpp/intrusive_slist.hpp>
+#include <zpp/latency_histogram.hpp>
+#include <zpp/lifo.hpp>
+#include <zpp/lock_stats.hpp>
+#include <zpp/mbox.hpp>
 #include <zpp/mem_slab.hpp>
 #include <zpp/futex.hpp>
+#include <zpp/msgq.hpp>
 #include <zpp/mutex.hpp>
+#include <zpp/periodic.hpp>
+#include <zpp/ring_buffer.hpp>
+#include <zpp/pipe.hpp>
 #include <zpp/sys_mutex.hpp>
 #include <zpp/poll.hpp>
 #include <zpp/sched.hpp>
 #include <zpp/sem.hpp>
+#include <zpp/stack.hpp>
 #include <zpp/thread.hpp>
+#include <zpp/thread_local_slot.hpp>
+#include <zpp/thread_runtime_stats.hpp>
 #include <zpp/timer.hpp>
+#include <zpp/timer_wheel.hpp>
+#include <zpp/triple_buffer.hpp>
 #include <zpp/lock_guard.hpp>
 #include <zpp/utils.hpp>
 #include <zpp/unique_lock.hpp>
@@ -0,0 +1,324 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_BROADCAST_HPP
+#define ZPP_INCLUDE_ZPP_BROADCAST_HPP
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/__assert.h>
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <zpp/clock.hpp>
+#include <zpp/condition_variable.hpp>
+#include <zpp/error_code.hpp>
+#include <zpp/lock_guard.hpp>
+#include <zpp/mutex.hpp>
+#include <zpp/result.hpp>
+
+namespace zpp {
+
+///
+/// @brief Ring that one writer publishes items to and many readers read
+///
+/// Publishing copies the item once into the ring, no matter how many
+/// readers there are. Every reader has its own cursor, a reader that
+/// falls more than @a T_Size items behind loses the oldest items and
+/// counts them. Each slot is protected by a sequence number, so readers
+/// never block the writer, and the writer only takes the mutex to wake
+/// readers when one of them is waiting.
+///
+/// There must be only one thread that publishes, and it must not be an
+/// ISR.
+///
+/// @param T_Item the item type, it must be trivially copyable
+/// @param T_Size the number of items in the ring, a power of two
+///
+template<class T_Item, size_t T_Size>
+class broadcast {
+  static_assert(std::is_trivially_copyable_v<T_Item>);
+  static_assert(T_Size >= 2);
+  static_assert(std::has_single_bit(T_Size));
+private:
+  using bytes = std::array<std::byte, sizeof(T_Item)>;
+
+  struct slot {
+    atomic_t                    seq{ 0 };
+    alignas(T_Item) bytes       data{};
+  };
+
+  // the sequence number a slot has while item @a n is written to it,
+  // and the one it has when item @a n is complete
+  static constexpr atomic_val_t busy_seq(uint32_t n) noexcept
+  {
+    return static_cast<atomic_val_t>(static_cast<uint32_t>(n / T_Size) * 2U + 1U);
+  }
+
+  static constexpr atomic_val_t done_seq(uint32_t n) noexcept
+  {
+    return static_cast<atomic_val_t>(static_cast<uint32_t>(n / T_Size) * 2U + 2U);
+  }
+public:
+  using value_type = T_Item;
+
+  ///
+  /// @brief A cursor of one reader
+  ///
+  /// A reader only sees the items published after it was created. It
+  /// must only be used by one thread at a time.
+  ///
+  class reader {
+  public:
+    ///
+    /// @brief create a reader of @a b
+    ///
+    /// @param b the broadcast to read
+    ///
+    explicit reader(broadcast& b) noexcept
+      : m_broadcast(&b)
+      , m_next(b.published())
+    {
+    }
+
+    ///
+    /// @brief the number of items that can be read without waiting
+    ///
+    /// @return the number of items, at most @a T_Size
+    ///
+    [[nodiscard]] size_t available() const noexcept
+    {
+      uint32_t n = m_broadcast->published() - m_next;
+
+      return n > T_Size ? T_Size : n;
+    }
+
+    ///
+    /// @brief the number of items this reader lost because it was
+    ///        overrun by the writer
+    ///
+    /// @return the number of lost items
+    ///
+    [[nodiscard]] uint32_t lost() const noexcept
+    {
+      return m_lost;
+    }
+
+    ///
+    /// @brief read the next item, waiting forever
+    ///
+    /// @return the item or an error code
+    ///
+    [[nodiscard]] result<T_Item, error_code> receive() noexcept
+    {
+      while (true) {
+        auto res = try_receive();
+        if (res) {
+          return res;
+        }
+
+        auto rc = m_broadcast->wait(*this, K_FOREVER);
+        if (!rc) {
+          return result<T_Item, error_code>(error_result(rc.error()));
+        }
+      }
+    }
+
+    ///
+    /// @brief read the next item without waiting
+    ///
+    /// @return the item or error_code::k_nomsg if there is none
+    ///
+    [[nodiscard]] result<T_Item, error_code> try_receive() noexcept
+    {
+      result<T_Item, error_code> res(error_result(error_code::k_nomsg));
+
+      auto& b = *m_broadcast;
+
+      while (true) {
+        uint32_t head = b.published();
+        uint32_t n = head - m_next;
+
+        if (n == 0) {
+          break;
+        }
+
+        if (n > T_Size) {
+          m_lost += n - T_Size;
+          m_next = head - T_Size;
+        }
+
+        auto& s = b.m_slots[m_next % T_Size];
+        auto seq = done_seq(m_next);
+
+        if (atomic_get(&s.seq) == seq) {
+          bytes copy;
+          std::memcpy(copy.data(), s.data.data(), sizeof(T_Item));
+          std::atomic_thread_fence(std::memory_order_acquire);
+
+          if (atomic_get(&s.seq) == seq) {
+            m_next++;
+            res.assign_value(std::bit_cast<T_Item>(copy));
+            break;
+          }
+        }
+
+        // the writer is overwriting the item, it is lost
+        m_lost++;
+        m_next++;
+      }
+
+      return res;
+    }
+
+    ///
+    /// @brief read the next item, waiting a certain amount of time
+    ///
+    /// @param timeout the time to wait
+    ///
+    /// @return the item or an error code
+    ///
+    template <class T_Rep, class T_Period>
+    [[nodiscard]] result<T_Item, error_code>
+    try_receive_for(const std::chrono::duration<T_Rep, T_Period>& timeout) noexcept
+    {
+      // a deadline makes sure lost items do not extend the timeout
+      return try_receive_until(uptime_clock::now() + timeout);
+    }
+
+    ///
+    /// @brief read the next item, waiting until a certain time
+    ///
+    /// @param abs_time the time point to wait until
+    ///
+    /// @return the item or an error code
+    ///
+    template <class T_Clock, class T_Duration>
+    [[nodiscard]] result<T_Item, error_code>
+    try_receive_until(const std::chrono::time_point<T_Clock, T_Duration>& abs_time) noexcept
+    {
+      while (true) {
+        auto res = try_receive();
+        if (res) {
+          return res;
+        }
+
+        auto rc = m_broadcast->wait(*this, abs_time);
+        if (!rc) {
+          return result<T_Item, error_code>(error_result(rc.error()));
+        }
+      }
+    }
+  private:
+    broadcast*  m_broadcast;
+    uint32_t    m_next;
+    uint32_t    m_lost{ 0 };
+  };
+public:
+  ///
+  /// @brief default constructor creating an empty ring
+  ///
+  broadcast() noexcept = default;
+
+  ///
+  /// @brief the number of items in the ring
+  ///
+  /// @return the number of items
+  ///
+  static constexpr size_t size() noexcept
+  {
+    return T_Size;
+  }
+
+  ///
+  /// @brief the number of items published so far, wraps at 2^32
+  ///
+  /// @return the number of published items
+  ///
+  [[nodiscard]] uint32_t published() const noexcept
+  {
+    return static_cast<uint32_t>(atomic_get(&m_published));
+  }
+
+  ///
+  /// @brief publish an item to all readers
+  ///
+  /// Must only be called by the one writer thread.
+  ///
+  /// @param item the item to publish
+  ///
+  void publish(const T_Item& item) noexcept
+  {
+    __ASSERT(!k_is_in_isr(), "broadcast published from an ISR");
+
+    uint32_t n = published();
+    auto& s = m_slots[n % T_Size];
+
+    atomic_set(&s.seq, busy_seq(n));
+    // readers must see the busy sequence before any of the new bytes
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::memcpy(s.data.data(), &item, sizeof(T_Item));
+
+    atomic_set(&s.seq, done_seq(n));
+    atomic_set(&m_published, static_cast<atomic_val_t>(n + 1));
+
+    if (atomic_get(&m_waiters) > 0) {
+      lock_guard<mutex> lg(m_lock);
+      auto rc = m_cv.notify_all();
+      __ASSERT_NO_MSG(rc);
+      (void)rc;
+    }
+  }
+private:
+  // a waiter is counted before it checks for items, and the writer
+  // checks for waiters after it published, so one of them sees the other
+  template<class T_Timeout>
+  [[nodiscard]] result<void, error_code> wait(const reader& r, T_Timeout timeout) noexcept
+  {
+    atomic_inc(&m_waiters);
+
+    result<void, error_code> res;
+    {
+      lock_guard<mutex> lg(m_lock);
+
+      auto pred = [&r]() noexcept { return r.available() > 0; };
+
+      if constexpr (std::is_same_v<T_Timeout, k_timeout_t>) {
+        (void)timeout;
+        res = m_cv.wait(m_lock, pred);
+      } else {
+        res = m_cv.try_wait_until(m_lock, timeout, pred);
+      }
+    }
+
+    atomic_dec(&m_waiters);
+
+    return res;
+  }
+private:
+  slot                m_slots[T_Size]{};
+  atomic_t            m_published{ 0 };
+  atomic_t            m_waiters{ 0 };
+  mutex               m_lock;
+  condition_variable  m_cv;
+public:
+  broadcast(const broadcast&) = delete;
+  broadcast(broadcast&&) = delete;
+  broadcast& operator=(const broadcast&) = delete;
+  broadcast& operator=(broadcast&&) = delete;
+};
+
+} // namespace zpp
+
+#endif // ZPP_INCLUDE_ZPP_BROADCAST_HPP
@@ -90,6 +90,64 @@ constexpr k_timeout_t to_timeout(const std::chrono::duration<T_Rep, T_Period>& d
   return { to_tick(d) };
 }
 
+///
+/// @brief convert a time_point to a timeout
+///
+/// For uptime_clock time points an absolute timeout is used when
+/// CONFIG_TIMEOUT_64BIT is enabled, so waiting until @a tp costs a
+/// single kernel call and does not accumulate wake-up jitter.
+///
+/// @param tp the time point to convert
+///
+/// @return the timeout expiring at @a tp
+///
+template<class T_Duration>
+inline k_timeout_t
+to_timeout(const std::chrono::time_point<uptime_clock, T_Duration>& tp) noexcept
+{
+  using namespace std::chrono;
+
+#ifdef CONFIG_TIMEOUT_64BIT
+  auto ns = duration_cast<nanoseconds>(tp.time_since_epoch()).count();
+  if (ns < 0) {
+    ns = 0;
+  }
+
+  k_ticks_t ticks = k_ns_to_ticks_ceil64(static_cast<uint64_t>(ns));
+  return K_TIMEOUT_ABS_TICKS(ticks);
+#else
+  auto d = tp - uptime_clock::now();
+  if (d <= decltype(d)::zero()) {
+    return K_NO_WAIT;
+  }
+
+  return { static_cast<k_ticks_t>(
+    k_ns_to_ticks_ceil64(duration_cast<nanoseconds>(d).count())) };
+#endif
+}
+
+///
+/// @brief convert a time_point to a relative timeout
+///
+/// @param tp the time point to convert
+///
+/// @return the timeout expiring at @a tp, measured from now
+///
+template<class T_Clock, class T_Duration>
+inline k_timeout_t
+to_timeout(const std::chrono::time_point<T_Clock, T_Duration>& tp) noexcept
+{
+  using namespace std::chrono;
+
+  auto d = tp - T_Clock::now();
+  if (d <= decltype(d)::zero()) {
+    return K_NO_WAIT;
+  }
+
+  return { static_cast<k_ticks_t>(
+    k_ns_to_ticks_ceil64(duration_cast<nanoseconds>(d).count())) };
+}
+
 } // namespace zpp
 
 #endif // ZPP_INCLUDE_ZPP_CLOCK_HPP
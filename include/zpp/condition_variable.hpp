@@ -12,28 +12,46 @@
 
 #include <chrono>
 
+#include <zpp/atomic_var.hpp>
+#include <zpp/clock.hpp>
 #include <zpp/mutex.hpp>
 #include <zpp/utils.hpp>
 #include <zpp/result.hpp>
 #include <zpp/error_code.hpp>
+#include <zpp/lock_stats.hpp>
 
 namespace zpp {
 
+///
+/// @brief result of the std like wait_for and wait_until functions
+///
+enum class cv_status {
+  no_timeout,
+  timeout,
+};
+
 ///
 /// @brief A condition variable CRTP base class.
 ///
-template<typename T_ConditionVariable>
+/// @param T_ConditionVariable the derived condition variable class
+/// @param T_LockStats the statistics policy, no_lock_stats or lock_stats
+///
+template<typename T_ConditionVariable, typename T_LockStats = no_lock_stats>
 class condition_variable_base
 {
 public:
   using native_type = struct k_condvar;
   using native_pointer = native_type*;
   using native_const_pointer = native_type const *;
+  using lock_stats_type = T_LockStats;
 protected:
   ///
   /// @brief Protected default constructor so only derived classes can be created
   ///
-  constexpr condition_variable_base() noexcept = default;
+  constexpr condition_variable_base() noexcept
+    : m_stats(lock_kind::condition_variable, this)
+  {
+  }
 public:
 
   ///
@@ -45,6 +63,11 @@ public:
   {
     result<void, error_code> res;
 
+    if (!may_have_waiters()) {
+      res.assign_value();
+      return res;
+    }
+
     auto rc = k_condvar_signal(native_handle());
     if (rc == 0) {
       res.assign_value();
@@ -64,8 +87,14 @@ public:
   {
     result<void, error_code> res;
 
+    if (!may_have_waiters()) {
+      res.assign_value();
+      return res;
+    }
+
+    // returns the number of woken threads
     auto rc = k_condvar_broadcast(native_handle());
-    if (rc == 0) {
+    if (rc >= 0) {
       res.assign_value();
     } else {
       res.assign_error(to_error_code(-rc));
@@ -74,6 +103,58 @@ public:
     return res;
   }
 
+  ///
+  /// @brief Notify one waiter and unlock the mutex.
+  ///
+  /// The scheduler is locked until the mutex is released, so on this CPU
+  /// a higher priority waiter does not run only to block on the mutex
+  /// again. With SMP another CPU can still run the waiter before that.
+  ///
+  /// @param m The mutex to unlock, must be locked by the caller
+  ///
+  /// @return true if successfull.
+  ///
+  template<class T_Mutex>
+  [[nodiscard]] auto notify_one_and_unlock(T_Mutex& m) noexcept
+  {
+    k_sched_lock();
+    auto res = notify_one();
+    auto unlock_res = m.unlock();
+    k_sched_unlock();
+
+    if (!res) {
+      return res;
+    }
+
+    return unlock_res;
+  }
+
+  ///
+  /// @brief Notify all waiters and unlock the mutex.
+  ///
+  /// The scheduler is locked until the mutex is released, so on this CPU
+  /// the waiters do not run only to block on the mutex again. With SMP
+  /// other CPUs can still run waiters before that.
+  ///
+  /// @param m The mutex to unlock, must be locked by the caller
+  ///
+  /// @return true if successfull.
+  ///
+  template<class T_Mutex>
+  [[nodiscard]] auto notify_all_and_unlock(T_Mutex& m) noexcept
+  {
+    k_sched_lock();
+    auto res = notify_all();
+    auto unlock_res = m.unlock();
+    k_sched_unlock();
+
+    if (!res) {
+      return res;
+    }
+
+    return unlock_res;
+  }
+
   ///
   /// @brief wait for ever until the variable is signaled.
   ///
@@ -90,7 +171,7 @@ public:
     if (h == nullptr) {
       res.assign_error(error_code::k_inval);
     } else {
-      auto rc = k_condvar_wait(native_handle(), h, K_FOREVER);
+      auto rc = wait_native(m, h, K_FOREVER);
       if (rc == 0) {
         res.assign_value();
       } else {
@@ -121,7 +202,7 @@ public:
     if (h == nullptr) {
       res.assign_error(error_code::k_inval);
     } else {
-      auto rc = k_condvar_wait(native_handle(), h, to_timeout(timeout));
+      auto rc = wait_native(m, h, to_timeout(timeout));
       if (rc == 0) {
         res.assign_value();
       } else {
@@ -151,7 +232,7 @@ public:
       res.assign_error(error_code::k_inval);
     } else {
       while (pred() == false) {
-        auto rc = k_condvar_wait(native_handle(), h, K_FOREVER);
+        auto rc = wait_native(m, h, K_FOREVER);
         if (rc != 0) {
           res.assign_error(to_error_code(-rc));
           return res;
@@ -177,8 +258,52 @@ public:
   [[nodiscard]] auto
   try_wait_for(T_Mutex& m, const std::chrono::duration<T_Rep, T_Period>& timeout, T_Predecate pred) noexcept
   {
-    using namespace std::chrono;
+    // a deadline makes sure spurious wakeups do not extend the timeout
+    return try_wait_until(m, uptime_clock::now() + timeout, pred);
+  }
+
+  ///
+  /// @brief Try waiting until a time point to see if the variable is signaled.
+  ///
+  /// @param m The mutex to use
+  /// @param abs_time The time point to wait until before returning
+  ///
+  /// @return true if successfull.
+  ///
+  template <class T_Mutex, class T_Clock, class T_Duration>
+  [[nodiscard]] auto
+  try_wait_until(T_Mutex& m, const std::chrono::time_point<T_Clock, T_Duration>& abs_time) noexcept
+  {
+    result<void, error_code> res;
+
+    auto h = m.native_handle();
+    if (h == nullptr) {
+      res.assign_error(error_code::k_inval);
+    } else {
+      auto rc = wait_native(m, h, to_timeout(abs_time));
+      if (rc == 0) {
+        res.assign_value();
+      } else {
+        res.assign_error(to_error_code(-rc));
+      }
+    }
 
+    return res;
+  }
+
+  ///
+  /// @brief Try waiting until a time point to see if the variable is signaled.
+  ///
+  /// @param m The mutex to use
+  /// @param abs_time The time point to wait until before returning
+  /// @param pred The predecate that must be true before the wait returns
+  ///
+  /// @return true if successfull.
+  ///
+  template <class T_Mutex, class T_Clock, class T_Duration, class T_Predecate>
+  [[nodiscard]] auto
+  try_wait_until(T_Mutex& m, const std::chrono::time_point<T_Clock, T_Duration>& abs_time, T_Predecate pred) noexcept
+  {
     result<void, error_code> res;
 
     auto h = m.native_handle();
@@ -186,13 +311,15 @@ public:
       res.assign_error(error_code::k_inval);
     } else {
       while(pred() == false) {
-        auto rc = k_condvar_wait(native_handle(), h, to_timeout(timeout));
+        auto rc = wait_native(m, h, to_timeout(abs_time));
         if (rc != 0) {
+          if (pred()) {
+            break;
+          }
+
           res.assign_error(to_error_code(-rc));
           return res;
         }
-
-        // TODO update timeout
       }
 
       res.assign_value();
@@ -201,6 +328,88 @@ public:
     return res;
   }
 
+  ///
+  /// @brief Wait with a timeout, like std::condition_variable::wait_for.
+  ///
+  /// @param m The mutex to use
+  /// @param timeout The time to wait before returning
+  ///
+  /// @return cv_status::timeout if the timeout expired.
+  ///
+  template <class T_Mutex, class T_Rep, class T_Period>
+  [[nodiscard]] cv_status
+  wait_for(T_Mutex& m, const std::chrono::duration<T_Rep, T_Period>& timeout) noexcept
+  {
+    return wait_until(m, uptime_clock::now() + timeout);
+  }
+
+  ///
+  /// @brief Wait with a timeout until a predicate is true, like
+  ///        std::condition_variable::wait_for.
+  ///
+  /// @param m The mutex to use
+  /// @param timeout The time to wait before returning
+  /// @param pred The predecate that must be true before the wait returns
+  ///
+  /// @return the value of @a pred when returning.
+  ///
+  template <class T_Mutex, class T_Rep, class T_Period, class T_Predecate>
+  [[nodiscard]] bool
+  wait_for(T_Mutex& m, const std::chrono::duration<T_Rep, T_Period>& timeout, T_Predecate pred) noexcept
+  {
+    return wait_until(m, uptime_clock::now() + timeout, pred);
+  }
+
+  ///
+  /// @brief Wait until a time point, like
+  ///        std::condition_variable::wait_until.
+  ///
+  /// Any clock can be used, uptime_clock time points use a single
+  /// absolute kernel timeout.
+  ///
+  /// @param m The mutex to use
+  /// @param abs_time The time point to wait until before returning
+  ///
+  /// @return cv_status::timeout if @a abs_time was reached.
+  ///
+  template <class T_Mutex, class T_Clock, class T_Duration>
+  [[nodiscard]] cv_status
+  wait_until(T_Mutex& m, const std::chrono::time_point<T_Clock, T_Duration>& abs_time) noexcept
+  {
+    auto h = m.native_handle();
+    __ASSERT_NO_MSG(h != nullptr);
+
+    auto rc = wait_native(m, h, to_timeout(abs_time));
+    if (rc == -EAGAIN) {
+      return cv_status::timeout;
+    }
+
+    return cv_status::no_timeout;
+  }
+
+  ///
+  /// @brief Wait until a time point or until a predicate is true, like
+  ///        std::condition_variable::wait_until.
+  ///
+  /// @param m The mutex to use
+  /// @param abs_time The time point to wait until before returning
+  /// @param pred The predecate that must be true before the wait returns
+  ///
+  /// @return the value of @a pred when returning.
+  ///
+  template <class T_Mutex, class T_Clock, class T_Duration, class T_Predecate>
+  [[nodiscard]] bool
+  wait_until(T_Mutex& m, const std::chrono::time_point<T_Clock, T_Duration>& abs_time, T_Predecate pred) noexcept
+  {
+    while (pred() == false) {
+      if (wait_until(m, abs_time) == cv_status::timeout) {
+        return pred();
+      }
+    }
+
+    return true;
+  }
+
   ///
   /// @brief get the native zephyr k_condvar pointer.
   ///
@@ -220,6 +429,73 @@ public:
   {
     return static_cast<const T_ConditionVariable*>(this)->native_handle();
   }
+
+  ///
+  /// @brief get the statistics of this condition variable
+  ///
+  /// @return the statistics policy object
+  ///
+  constexpr auto stats() noexcept -> lock_stats_type&
+  {
+    return m_stats;
+  }
+private:
+  static constexpr bool counts_waiters() noexcept
+  {
+    return requires (T_ConditionVariable& cv) { cv.waiters(); };
+  }
+
+  bool may_have_waiters() noexcept
+  {
+    if constexpr (counts_waiters()) {
+      return static_cast<T_ConditionVariable*>(this)->waiters() != 0;
+    } else {
+      return true;
+    }
+  }
+
+  template<class T_Mutex>
+  int wait_native(T_Mutex& m, struct k_mutex* h, k_timeout_t timeout) noexcept
+  {
+    // k_condvar_wait releases and retakes the mutex, keep the hold
+    // time of an instrumented mutex correct
+    constexpr bool mutex_stats = requires { m.stats().unlocking(); };
+
+    uint32_t start = 0;
+    if constexpr (T_LockStats::enabled) {
+      start = T_LockStats::now();
+    }
+
+    if constexpr (mutex_stats) {
+      m.stats().unlocking();
+    }
+
+    // counted while the mutex is held, so a notifier that changed the
+    // predicate under the same mutex always sees this waiter
+    if constexpr (counts_waiters()) {
+      static_cast<T_ConditionVariable*>(this)->m_waiters.fetch_inc();
+    }
+
+    auto rc = k_condvar_wait(native_handle(), h, timeout);
+
+    if constexpr (counts_waiters()) {
+      static_cast<T_ConditionVariable*>(this)->m_waiters.fetch_dec();
+    }
+
+    if constexpr (mutex_stats) {
+      m.stats().locked(lock_stats::now(), false);
+    }
+
+    if constexpr (T_LockStats::enabled) {
+      if (rc == 0) {
+        m_stats.acquired(start, true);
+      }
+    }
+
+    return rc;
+  }
+private:
+  [[no_unique_address]] T_LockStats m_stats;
 public:
   condition_variable_base(const condition_variable_base&) = delete;
   condition_variable_base(condition_variable_base&&) = delete;
@@ -231,7 +507,7 @@ public:
 /// @brief A condition variable class.
 ///
 class condition_variable
-  : public condition_variable_base<condition_variable> {
+  : public condition_variable_base<condition_variable, default_lock_stats> {
 public:
   ///
   /// @brief Default constructor
@@ -268,6 +544,68 @@ public:
   condition_variable& operator=(condition_variable&&) = delete;
 };
 
+///
+/// @brief A condition variable that counts its waiters.
+///
+/// notify_one() and notify_all() return without entering the kernel when
+/// nobody waits. No wakeup is lost as long as the predicate is changed
+/// while holding the mutex used by the waiters, the notify itself can
+/// be done with or without holding it.
+///
+/// Waiting through a condition_variable_ref bypasses the count, so all
+/// waiters must use this object.
+///
+class counting_condition_variable
+  : public condition_variable_base<counting_condition_variable, default_lock_stats> {
+public:
+  ///
+  /// @brief Default constructor
+  ///
+  counting_condition_variable() noexcept
+  {
+    k_condvar_init(&m_condvar);
+  }
+
+  ///
+  /// @brief get the number of threads waiting
+  ///
+  /// @return the number of waiting threads
+  ///
+  [[nodiscard]] auto waiters() const noexcept
+  {
+    return m_waiters.load();
+  }
+
+  ///
+  /// @brief get the native zephyr condition variable handle.
+  ///
+  /// @return A pointer to the zephyr k_condvar pointer.
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return &m_condvar;
+  }
+  ///
+  /// @brief get the native zephyr condition variable handle.
+  ///
+  /// @return A pointer to the zephyr k_condvar pointer.
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return &m_condvar;
+  }
+private:
+  friend class condition_variable_base<counting_condition_variable, default_lock_stats>;
+private:
+  native_type m_condvar{};
+  atomic_var  m_waiters;
+public:
+  counting_condition_variable(const counting_condition_variable&) = delete;
+  counting_condition_variable(counting_condition_variable&&) = delete;
+  counting_condition_variable& operator=(const counting_condition_variable&) = delete;
+  counting_condition_variable& operator=(counting_condition_variable&&) = delete;
+};
+
 ///
 /// @brief A class using a reference to another native condition variable
 ///        or zpp::condition_variable.
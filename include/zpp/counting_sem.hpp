@@ -0,0 +1,252 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_COUNTING_SEM_HPP
+#define ZPP_INCLUDE_ZPP_COUNTING_SEM_HPP
+
+#include <zpp/clock.hpp>
+#include <zpp/intrusive_dlist.hpp>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+
+namespace zpp {
+
+///
+/// @brief A counting semaphore that takes and gives several units at once
+///
+/// The count is kept under a spinlock and acquire(n) only takes units
+/// when all @a n are available, a waiting thread never holds part of
+/// them. Two threads that each wait for more than half of a fixed pool
+/// of credits can therefore not block each other for ever.
+///
+/// Every waiting thread sleeps on its own k_sem in a list, release()
+/// takes all waiters off the list and gives each of them its k_sem, so a
+/// wake up can not be taken by another thread. A woken thread that still
+/// finds too few units adds itself to the list again. release() walks the
+/// list with the spinlock held, so it takes longer with many waiters.
+///
+/// Small requests can overtake a large one that is waiting, there is no
+/// first come first served order. release() and try_acquire() can be
+/// used from an ISR.
+///
+class counting_sem {
+public:
+  ///
+  /// @brief Type used as counter
+  ///
+  using counter_type = uint32_t;
+
+  ///
+  /// @brief Maximum value of the counter
+  ///
+  constexpr static counter_type max_count =
+        std::numeric_limits<counter_type>::max();
+public:
+  ///
+  /// @brief Constructor initializing initial count and count limit.
+  ///
+  /// @param initial_count The initial number of units
+  /// @param count_limit The maximum number of units
+  ///
+  counting_sem(counter_type initial_count, counter_type count_limit) noexcept
+    : m_count(initial_count)
+    , m_limit(count_limit)
+  {
+    __ASSERT_NO_MSG(count_limit > 0);
+    __ASSERT_NO_MSG(initial_count <= count_limit);
+
+  }
+
+  ///
+  /// @brief Constructor initializing initial count.
+  ///
+  /// @param initial_count The initial number of units
+  ///
+  explicit counting_sem(counter_type initial_count) noexcept
+    : counting_sem(initial_count, max_count)
+  {
+  }
+
+  ///
+  /// @brief Default constructor, starting without units
+  ///
+  counting_sem() noexcept
+    : counting_sem(0, max_count)
+  {
+  }
+
+  ///
+  /// @brief Get the current number of units
+  ///
+  /// @return The number of units that can be taken
+  ///
+  [[nodiscard]] counter_type count() noexcept
+  {
+    auto key = k_spin_lock(&m_lock);
+    auto n = m_count;
+    k_spin_unlock(&m_lock, key);
+
+    return n;
+  }
+
+  ///
+  /// @brief Take @a n units waiting forever
+  ///
+  /// @param n The number of units to take, at most the count limit
+  ///
+  /// @return true when all units were taken
+  ///
+  [[nodiscard]] bool acquire(counter_type n) noexcept
+  {
+    return acquire_native(n, [] { return K_FOREVER; }) == 0;
+  }
+
+  ///
+  /// @brief Try to take @a n units without waiting
+  ///
+  /// @param n The number of units to take
+  ///
+  /// @return true when all units were taken, no units are taken otherwise
+  ///
+  [[nodiscard]] bool try_acquire(counter_type n) noexcept
+  {
+    return acquire_native(n, [] { return K_NO_WAIT; }) == 0;
+  }
+
+  ///
+  /// @brief Try to take @a n units waiting a certain timeout
+  ///
+  /// @param n The number of units to take, at most the count limit
+  /// @param timeout_duration The timeout to wait before giving up
+  ///
+  /// @return true when all units were taken, no units are taken otherwise
+  ///
+  template<class T_Rep, class T_Period>
+  [[nodiscard]] bool
+  try_acquire_for(counter_type n,
+                  const std::chrono::duration<T_Rep, T_Period>&
+                    timeout_duration) noexcept
+  {
+    return try_acquire_until(n, uptime_clock::now() + timeout_duration);
+  }
+
+  ///
+  /// @brief Try to take @a n units waiting until a certain time
+  ///
+  /// @param n The number of units to take, at most the count limit
+  /// @param abs_time The time point to wait until before giving up
+  ///
+  /// @return true when all units were taken, no units are taken otherwise
+  ///
+  template<class T_Clock, class T_Duration>
+  [[nodiscard]] bool
+  try_acquire_until(counter_type n,
+                    const std::chrono::time_point<T_Clock, T_Duration>&
+                      abs_time) noexcept
+  {
+    return acquire_native(n, [&abs_time] { return to_timeout(abs_time); }) == 0;
+  }
+
+  ///
+  /// @brief Give @a n units
+  ///
+  /// The count is raised at once and every waiting thread is woken to
+  /// check if its request can be met. Like k_sem the count does not go
+  /// above the count limit.
+  ///
+  /// @param n The number of units to give
+  ///
+  void release(counter_type n) noexcept
+  {
+    auto key = k_spin_lock(&m_lock);
+
+    m_count = (m_limit - m_count < n) ? m_limit : m_count + n;
+
+    // the k_sem lives on the stack of the waiter, it is only valid while
+    // the waiter is on the list and the lock is held
+    auto w = m_waiters.pop_front();
+    while (w != nullptr) {
+      k_sem_give(&w->wake);
+      w = m_waiters.pop_front();
+    }
+
+    k_spin_unlock(&m_lock, key);
+  }
+private:
+  struct waiter {
+    sys_dnode_t   node{};
+    struct k_sem  wake;
+  };
+
+  using waiter_list = intrusive_dlist<waiter, &waiter::node>;
+
+  template<class T_TimeoutFunc>
+  int acquire_native(counter_type n, T_TimeoutFunc timeout) noexcept
+  {
+    __ASSERT(n <= m_limit, "more units than the count limit");
+
+    auto key = k_spin_lock(&m_lock);
+
+    while (m_count < n) {
+      // the timeout is calculated again after every wake up, so waking
+      // up without enough units does not restart a relative timeout
+      auto t = timeout();
+      if (K_TIMEOUT_EQ(t, K_NO_WAIT) || n > m_limit) {
+        k_spin_unlock(&m_lock, key);
+        return -EBUSY;
+      }
+
+      // a release() between the unlock and the take leaves its give in
+      // the k_sem of this waiter, so the wake up is not lost
+      waiter w;
+      k_sem_init(&w.wake, 0, 1);
+      m_waiters.push_back(w);
+
+      k_spin_unlock(&m_lock, key);
+
+      auto rc = k_sem_take(&w.wake, t);
+
+      key = k_spin_lock(&m_lock);
+
+      if (rc != 0) {
+        if (waiter_list::is_linked(w)) {
+          waiter_list::remove(w);
+        }
+
+        // units released just before the timeout are still taken
+        if (m_count < n) {
+          k_spin_unlock(&m_lock, key);
+          return rc;
+        }
+      }
+    }
+
+    m_count -= n;
+
+    k_spin_unlock(&m_lock, key);
+
+    return 0;
+  }
+private:
+  struct k_spinlock m_lock{};
+  counter_type      m_count;
+  counter_type      m_limit;
+  waiter_list       m_waiters;
+public:
+  counting_sem(const counting_sem&) = delete;
+  counting_sem(counting_sem&&) = delete;
+  counting_sem& operator=(const counting_sem&) = delete;
+  counting_sem& operator=(counting_sem&&) = delete;
+};
+
+} // namespace zpp
+
+#endif // ZPP_INCLUDE_ZPP_COUNTING_SEM_HPP
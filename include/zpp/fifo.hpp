@@ -9,14 +9,184 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/sys/__assert.h>
+#include <zephyr/sys/slist.h>
+
+#include <zpp/clock.hpp>
 
 #include <chrono>
+#include <cstdint>
+#include <iterator>
 #include <limits>
 #include <type_traits>
 #include <cstddef>
 
 namespace zpp {
 
+///
+/// @brief List of items taken from a fifo in one go
+///
+/// The items are linked through their fifo_reserved member, the list
+/// does not own them. The iterator reads the next item before the
+/// current one is used, so the items can be pushed into another fifo
+/// while iterating.
+///
+/// @param T_ItemType the item type of the fifo
+///
+template<typename T_ItemType>
+class fifo_list {
+public:
+  using item_type = T_ItemType;
+  using item_pointer = item_type*;
+
+  ///
+  /// @brief forward iterator over the items of the list
+  ///
+  class iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = item_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = item_pointer;
+    using reference = item_type&;
+  public:
+    constexpr iterator() noexcept = default;
+
+    constexpr explicit iterator(item_pointer item) noexcept
+      : m_item(item)
+      , m_next(next_of(item))
+    {
+    }
+
+    constexpr reference operator*() const noexcept
+    {
+      __ASSERT_NO_MSG(m_item != nullptr);
+      return *m_item;
+    }
+
+    constexpr pointer operator->() const noexcept
+    {
+      __ASSERT_NO_MSG(m_item != nullptr);
+      return m_item;
+    }
+
+    constexpr iterator& operator++() noexcept
+    {
+      m_item = m_next;
+      m_next = next_of(m_item);
+      return *this;
+    }
+
+    constexpr iterator operator++(int) noexcept
+    {
+      auto tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    constexpr bool operator==(const iterator& rhs) const noexcept
+    {
+      return m_item == rhs.m_item;
+    }
+  private:
+    static constexpr item_pointer next_of(item_pointer item) noexcept
+    {
+      if (item == nullptr) {
+        return nullptr;
+      }
+
+      return static_cast<item_pointer>(item->fifo_reserved);
+    }
+  private:
+    item_pointer m_item{ nullptr };
+    item_pointer m_next{ nullptr };
+  };
+public:
+  ///
+  /// @brief create an empty list
+  ///
+  constexpr fifo_list() noexcept = default;
+
+  ///
+  /// @brief create a list from linked items
+  ///
+  /// @param head the first item, the last item has a nullptr fifo_reserved
+  ///
+  constexpr explicit fifo_list(item_pointer head) noexcept
+    : m_head(head)
+  {
+  }
+
+  ///
+  /// @brief get an iterator to the first item
+  ///
+  /// @return iterator to the first item
+  ///
+  [[nodiscard]] constexpr iterator begin() const noexcept
+  {
+    return iterator(m_head);
+  }
+
+  ///
+  /// @brief get the end iterator
+  ///
+  /// @return the end iterator
+  ///
+  [[nodiscard]] constexpr iterator end() const noexcept
+  {
+    return iterator();
+  }
+
+  ///
+  /// @brief check if the list is empty
+  ///
+  /// @return true if the list is empty
+  ///
+  [[nodiscard]] constexpr bool empty() const noexcept
+  {
+    return m_head == nullptr;
+  }
+
+  ///
+  /// @brief count the items in the list
+  ///
+  /// @return the number of items
+  ///
+  [[nodiscard]] constexpr size_t size() const noexcept
+  {
+    size_t n = 0;
+    for (auto it = begin(); it != end(); ++it) {
+      n++;
+    }
+    return n;
+  }
+
+  ///
+  /// @brief get the first item
+  ///
+  /// @return the first item or nullptr when the list is empty
+  ///
+  [[nodiscard]] constexpr item_pointer front() const noexcept
+  {
+    return m_head;
+  }
+
+  ///
+  /// @brief remove the first item from the list
+  ///
+  /// @return the first item or nullptr when the list is empty
+  ///
+  constexpr item_pointer pop_front() noexcept
+  {
+    auto item = m_head;
+    if (item != nullptr) {
+      m_head = static_cast<item_pointer>(item->fifo_reserved);
+    }
+    return item;
+  }
+private:
+  item_pointer m_head{ nullptr };
+};
+
 ///
 /// @brief Fifo CRTP base class
 ///
@@ -82,6 +252,117 @@ public:
     k_fifo_put(native_handle(), item);
   }
 
+  ///
+  /// @brief push a range of items on the back of the fifo in one operation
+  ///
+  /// Waiting threads are woken up once for the whole range instead of
+  /// once for every item.
+  ///
+  /// @param first iterator to the first item, the range can contain
+  ///        items or item pointers
+  /// @param last iterator past the last item
+  ///
+  template<std::forward_iterator T_Iterator>
+  void push_back_list(T_Iterator first, T_Iterator last) noexcept
+  {
+    item_pointer head{ nullptr };
+    item_pointer tail{ nullptr };
+
+    while (first != last) {
+      item_pointer item = to_item_pointer(*first);
+      ++first;
+
+      item->fifo_reserved = nullptr;
+      if (tail == nullptr) {
+        head = item;
+      } else {
+        tail->fifo_reserved = item;
+      }
+      tail = item;
+    }
+
+    if (head != nullptr) {
+      k_fifo_put_list(native_handle(), head, tail);
+    }
+  }
+
+  ///
+  /// @brief push all items of a sys_slist_t on the back of the fifo
+  ///
+  /// The list must link the items through their fifo_reserved member,
+  /// it is empty afterwards.
+  ///
+  /// @param list the list to move into the fifo
+  ///
+  void push_back_slist(sys_slist_t* list) noexcept
+  {
+    __ASSERT_NO_MSG(list != nullptr);
+
+    if (!sys_slist_is_empty(list)) {
+      k_fifo_put_slist(native_handle(), list);
+    }
+  }
+
+  ///
+  /// @brief take all items from the fifo waiting for ever for the first
+  ///
+  /// @param max_items the maximum number of items to take
+  ///
+  /// @return the items, the list is only empty on error
+  ///
+  [[nodiscard]] fifo_list<item_type>
+  pop_all(size_t max_items = std::numeric_limits<size_t>::max()) noexcept
+  {
+    return pop_all_native(K_FOREVER, max_items);
+  }
+
+  ///
+  /// @brief take all items from the fifo without waiting
+  ///
+  /// @param max_items the maximum number of items to take
+  ///
+  /// @return the items, empty when the fifo was empty
+  ///
+  [[nodiscard]] fifo_list<item_type>
+  try_pop_all(size_t max_items = std::numeric_limits<size_t>::max()) noexcept
+  {
+    return pop_all_native(K_NO_WAIT, max_items);
+  }
+
+  ///
+  /// @brief take all items from the fifo waiting a certain amount of
+  ///        time for the first
+  ///
+  /// @param timeout The timeout before returning
+  /// @param max_items the maximum number of items to take
+  ///
+  /// @return the items, empty on timeout
+  ///
+  template <class T_Rep, class T_Period>
+  [[nodiscard]] fifo_list<item_type>
+  try_pop_all_for(const std::chrono::duration<T_Rep, T_Period>& timeout,
+                  size_t max_items = std::numeric_limits<size_t>::max()) noexcept
+  {
+    return pop_all_native(to_timeout(timeout), max_items);
+  }
+
+  ///
+  /// @brief take all items from the fifo waiting until a certain time
+  ///        for the first
+  ///
+  /// @param abs_time The time point to wait until
+  /// @param max_items the maximum number of items to take
+  ///
+  /// @return the items, empty on timeout
+  ///
+  template <class T_Clock, class T_Duration>
+  [[nodiscard]] fifo_list<item_type>
+  try_pop_all_until(const std::chrono::time_point<T_Clock, T_Duration>& abs_time,
+                    size_t max_items = std::numeric_limits<size_t>::max()) noexcept
+  {
+    return pop_all_native(to_timeout(abs_time), max_items);
+  }
+
   ///
   /// @brief pop item from fifo waiting for ever
   ///
@@ -117,11 +398,23 @@ public:
   [[nodiscard]] item_pointer
   try_pop_front_for(const std::chrono::duration<T_Rep, T_Period>& timeout) noexcept
   {
-    using namespace std::chrono;
+    return static_cast<item_pointer>(
+      k_fifo_get(native_handle(), to_timeout(timeout)));
+  }
 
+  ///
+  /// @brief try to pop item from the fifo waiting until a certain time
+  ///
+  /// @param abs_time The time point to wait until
+  ///
+  /// @return the item or nullptr on error/timeout
+  ///
+  template <class T_Clock, class T_Duration>
+  [[nodiscard]] item_pointer
+  try_pop_front_until(const std::chrono::time_point<T_Clock, T_Duration>& abs_time) noexcept
+  {
     return static_cast<item_pointer>(
-      k_fifo_get(native_handle(),
-      duration_cast<milliseconds>(timeout).count()));
+      k_fifo_get(native_handle(), to_timeout(abs_time)));
   }
 
   ///
@@ -161,6 +454,44 @@ public:
       return true;
     }
   }
+private:
+  static item_pointer to_item_pointer(item_pointer item) noexcept
+  {
+    return item;
+  }
+
+  static item_pointer to_item_pointer(item_type& item) noexcept
+  {
+    return &item;
+  }
+
+  fifo_list<item_type> pop_all_native(k_timeout_t timeout, size_t max_items) noexcept
+  {
+    if (max_items == 0) {
+      return fifo_list<item_type>();
+    }
+
+    auto head = static_cast<item_pointer>(k_fifo_get(native_handle(), timeout));
+    if (head == nullptr) {
+      return fifo_list<item_type>();
+    }
+
+    // Zephyr has no call to detach the whole list, so after the first
+    // item the rest is taken without waiting, which never reschedules
+    auto tail = head;
+    for (size_t n = 1; n < max_items; n++) {
+      auto item = static_cast<item_pointer>(
+        k_fifo_get(native_handle(), K_NO_WAIT));
+      if (item == nullptr) {
+        break;
+      }
+      tail->fifo_reserved = item;
+      tail = item;
+    }
+    tail->fifo_reserved = nullptr;
+
+    return fifo_list<item_type>(head);
+  }
 public:
   fifo_base(const fifo_base&) = delete;
   fifo_base(fifo_base&&) = delete;
@@ -31,8 +31,8 @@ inline void print_arg(uint16_t v) noexcept { printk("%d", (uint32_t)v); }
 inline void print_arg(int16_t v) noexcept { printk("%d", (int32_t)v); }
 inline void print_arg(uint32_t v) noexcept { printk("%d", v); }
 inline void print_arg(int32_t v) noexcept { printk("%d", v); }
-inline void print_arg(uint64_t v) noexcept { printk("%lld", v); }
-inline void print_arg(int64_t v) noexcept { printk("%lld", v); }
+inline void print_arg(uint64_t v) noexcept { printk("%llu", (unsigned long long)v); }
+inline void print_arg(int64_t v) noexcept { printk("%lld", (long long)v); }
 
 template<class T_Rep, class T_Period>
 inline void print_arg(std::chrono::duration<T_Rep, T_Period> v)
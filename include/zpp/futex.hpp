@@ -136,6 +136,11 @@ public:
 ///
 class futex : public futex_base<futex> {
 public:
+  ///
+  /// @brief Default constructor
+  ///
+  constexpr futex() noexcept = default;
+
   ///
   /// @brief get the native zephyr futex handle.
   ///
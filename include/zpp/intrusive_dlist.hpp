@@ -0,0 +1,355 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_INTRUSIVE_DLIST_HPP
+#define ZPP_INCLUDE_ZPP_INTRUSIVE_DLIST_HPP
+
+#include <zpp/utils.hpp>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/dlist.h>
+
+#include <cstddef>
+#include <iterator>
+
+namespace zpp {
+
+///
+/// @brief Doubly linked list of objects containing a sys_dnode_t
+///
+/// The list never allocates, the objects are linked through their
+/// @a T_Node member. Removing an object and moving all objects of one
+/// list to another are O(1), which makes it a good base for LRU lists
+/// and timer lists.
+///
+/// The nodes point back to the list head, so the list can not be moved.
+///
+/// @param T_Item the type of the objects in the list
+/// @param T_Node pointer to the sys_dnode_t member of @a T_Item
+///
+template<typename T_Item, sys_dnode_t T_Item::* T_Node>
+class intrusive_dlist {
+public:
+  using native_type = sys_dlist_t;
+  using native_pointer = native_type *;
+  using native_const_pointer = native_type const *;
+
+  using value_type = T_Item;
+  using reference = T_Item&;
+  using pointer = T_Item*;
+  using size_type = size_t;
+
+  ///
+  /// @brief bidirectional iterator over the list
+  ///
+  class iterator {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T_Item;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T_Item*;
+    using reference = T_Item&;
+  public:
+    constexpr iterator() noexcept = default;
+
+    constexpr iterator(sys_dlist_t* list, sys_dnode_t* node) noexcept
+      : m_list(list)
+      , m_node(node)
+    {
+    }
+
+    reference operator*() const noexcept
+    {
+      __ASSERT_NO_MSG(m_node != nullptr);
+      return *to_item(m_node);
+    }
+
+    pointer operator->() const noexcept
+    {
+      __ASSERT_NO_MSG(m_node != nullptr);
+      return to_item(m_node);
+    }
+
+    iterator& operator++() noexcept
+    {
+      __ASSERT_NO_MSG(m_node != nullptr);
+      m_node = sys_dlist_peek_next(m_list, m_node);
+      return *this;
+    }
+
+    iterator operator++(int) noexcept
+    {
+      auto tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    iterator& operator--() noexcept
+    {
+      if (m_node == nullptr) {
+        m_node = sys_dlist_peek_tail(m_list);
+      } else {
+        m_node = sys_dlist_peek_prev(m_list, m_node);
+      }
+      return *this;
+    }
+
+    iterator operator--(int) noexcept
+    {
+      auto tmp = *this;
+      --(*this);
+      return tmp;
+    }
+
+    friend constexpr bool operator==(const iterator& lhs, const iterator& rhs) noexcept
+    {
+      return lhs.m_node == rhs.m_node;
+    }
+
+    friend constexpr bool operator!=(const iterator& lhs, const iterator& rhs) noexcept
+    {
+      return lhs.m_node != rhs.m_node;
+    }
+
+    ///
+    /// @brief get the node the iterator points to
+    ///
+    /// @return pointer to the node, nullptr for the end iterator
+    ///
+    constexpr sys_dnode_t* native_handle() const noexcept
+    {
+      return m_node;
+    }
+  private:
+    sys_dlist_t* m_list{ nullptr };
+    sys_dnode_t* m_node{ nullptr };
+  };
+public:
+  ///
+  /// @brief create an empty list
+  ///
+  intrusive_dlist() noexcept
+  {
+    sys_dlist_init(&m_list);
+  }
+
+  ///
+  /// @brief get an iterator to the first object
+  ///
+  /// @return iterator to the first object
+  ///
+  [[nodiscard]] iterator begin() noexcept
+  {
+    return iterator(&m_list, sys_dlist_peek_head(&m_list));
+  }
+
+  ///
+  /// @brief get the end iterator
+  ///
+  /// @return the end iterator
+  ///
+  [[nodiscard]] iterator end() noexcept
+  {
+    return iterator(&m_list, nullptr);
+  }
+
+  ///
+  /// @brief check if the list is empty
+  ///
+  /// @return true if the list is empty
+  ///
+  [[nodiscard]] bool empty() noexcept
+  {
+    return sys_dlist_is_empty(&m_list);
+  }
+
+  ///
+  /// @brief count the objects in the list, this is O(n)
+  ///
+  /// @return the number of objects
+  ///
+  [[nodiscard]] size_type size() noexcept
+  {
+    return sys_dlist_len(&m_list);
+  }
+
+  ///
+  /// @brief get the first object
+  ///
+  /// @return the first object or nullptr when the list is empty
+  ///
+  [[nodiscard]] pointer front() noexcept
+  {
+    return to_item(sys_dlist_peek_head(&m_list));
+  }
+
+  ///
+  /// @brief get the last object
+  ///
+  /// @return the last object or nullptr when the list is empty
+  ///
+  [[nodiscard]] pointer back() noexcept
+  {
+    return to_item(sys_dlist_peek_tail(&m_list));
+  }
+
+  ///
+  /// @brief add an object at the front of the list
+  ///
+  /// @param item the object to add, must not be in a list
+  ///
+  void push_front(reference item) noexcept
+  {
+    __ASSERT_NO_MSG(!is_linked(item));
+    sys_dlist_prepend(&m_list, &(item.*T_Node));
+  }
+
+  ///
+  /// @brief add an object at the back of the list
+  ///
+  /// @param item the object to add, must not be in a list
+  ///
+  void push_back(reference item) noexcept
+  {
+    __ASSERT_NO_MSG(!is_linked(item));
+    sys_dlist_append(&m_list, &(item.*T_Node));
+  }
+
+  ///
+  /// @brief add an object before another object
+  ///
+  /// @param pos the object to insert before, must be in this list
+  /// @param item the object to add, must not be in a list
+  ///
+  void insert_before(reference pos, reference item) noexcept
+  {
+    __ASSERT_NO_MSG(!is_linked(item));
+    sys_dlist_insert(&(pos.*T_Node), &(item.*T_Node));
+  }
+
+  ///
+  /// @brief remove the first object
+  ///
+  /// @return the removed object or nullptr when the list is empty
+  ///
+  pointer pop_front() noexcept
+  {
+    return to_item(sys_dlist_get(&m_list));
+  }
+
+  ///
+  /// @brief remove the last object
+  ///
+  /// @return the removed object or nullptr when the list is empty
+  ///
+  pointer pop_back() noexcept
+  {
+    auto node = sys_dlist_peek_tail(&m_list);
+    if (node != nullptr) {
+      sys_dlist_remove(node);
+      sys_dnode_init(node);
+    }
+    return to_item(node);
+  }
+
+  ///
+  /// @brief remove an object from the list it is in, this is O(1)
+  ///
+  /// @param item the object to remove, must be in a list
+  ///
+  static void remove(reference item) noexcept
+  {
+    __ASSERT_NO_MSG(is_linked(item));
+    sys_dlist_remove(&(item.*T_Node));
+    sys_dnode_init(&(item.*T_Node));
+  }
+
+  ///
+  /// @brief check if an object is in a list
+  ///
+  /// The node must have been initialized with sys_dnode_init(), or
+  /// zero initialized, before it was first used.
+  ///
+  /// @param item the object to check
+  ///
+  /// @return true if @a item is in a list
+  ///
+  [[nodiscard]] static bool is_linked(const T_Item& item) noexcept
+  {
+    return sys_dnode_is_linked(&(item.*T_Node));
+  }
+
+  ///
+  /// @brief move all objects of another list to the back of this list
+  ///        in O(1)
+  ///
+  /// @param other the list to take the objects from, empty afterwards
+  ///
+  void splice(intrusive_dlist& other) noexcept
+  {
+    __ASSERT_NO_MSG(&other != this);
+
+    if (other.empty()) {
+      return;
+    }
+
+    sys_dnode_t* first = other.m_list.head;
+    sys_dnode_t* last = other.m_list.tail;
+
+    first->prev = m_list.tail;
+    last->next = &m_list;
+    m_list.tail->next = first;
+    m_list.tail = last;
+
+    sys_dlist_init(&other.m_list);
+  }
+
+  ///
+  /// @brief remove all objects from the list
+  ///
+  void clear() noexcept
+  {
+    while (pop_front() != nullptr) {
+    }
+  }
+
+  ///
+  /// @brief get the Zephyr native list
+  ///
+  /// @return pointer to the sys_dlist_t
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return &m_list;
+  }
+
+  ///
+  /// @brief get the Zephyr native list
+  ///
+  /// @return pointer to the sys_dlist_t
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return &m_list;
+  }
+private:
+  static pointer to_item(sys_dnode_t* node) noexcept
+  {
+    return internal::container_of(node, T_Node);
+  }
+private:
+  native_type m_list;
+public:
+  intrusive_dlist(const intrusive_dlist&) = delete;
+  intrusive_dlist(intrusive_dlist&&) = delete;
+  intrusive_dlist& operator=(const intrusive_dlist&) = delete;
+  intrusive_dlist& operator=(intrusive_dlist&&) = delete;
+};
+
+} // namespace zpp
+
+#endif // ZPP_INCLUDE_ZPP_INTRUSIVE_DLIST_HPP
@@ -0,0 +1,361 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_INTRUSIVE_RBTREE_HPP
+#define ZPP_INCLUDE_ZPP_INTRUSIVE_RBTREE_HPP
+
+#include <zpp/utils.hpp>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/rb.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+namespace zpp {
+
+///
+/// @brief Balanced tree of objects containing a struct rbnode
+///
+/// The tree never allocates, the objects are linked through their
+/// @a T_Node member and kept sorted with @a T_Compare. Objects that
+/// compare equal are allowed.
+///
+/// The Zephyr tree calls a plain function to compare nodes, so
+/// @a T_Compare must be stateless.
+///
+/// @param T_Item the type of the objects in the tree
+/// @param T_Node pointer to the rbnode member of @a T_Item
+/// @param T_Compare the ordering, std::less<> by default
+///
+template<typename T_Item, rbnode T_Item::* T_Node,
+         typename T_Compare = std::less<>>
+class intrusive_rbtree {
+public:
+  using native_type = struct rbtree;
+  using native_pointer = native_type *;
+  using native_const_pointer = native_type const *;
+
+  using value_type = T_Item;
+  using reference = T_Item&;
+  using pointer = T_Item*;
+  using size_type = size_t;
+  using compare_type = T_Compare;
+
+  static_assert(std::is_empty_v<compare_type>
+                && std::is_default_constructible_v<compare_type>,
+                "compare must be stateless");
+
+  ///
+  /// @brief in order forward iterator over the tree
+  ///
+  /// The iterator keeps the path to the current node, so it is large
+  /// and should not be stored. Changing the tree invalidates it. The
+  /// end of the tree is std::default_sentinel, comparing with it only
+  /// checks for a null node.
+  ///
+  class iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T_Item;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T_Item*;
+    using reference = T_Item&;
+  public:
+    iterator() noexcept
+    {
+      reset_state(-1);
+    }
+
+    explicit iterator(struct rbtree* tree) noexcept
+      : m_tree(tree)
+    {
+      reset_state(-1);
+      m_node = z_rb_foreach_next(m_tree, &m_state);
+    }
+
+    iterator(const iterator& other) noexcept
+      : m_tree(other.m_tree)
+      , m_node(other.m_node)
+      , m_stack(other.m_stack)
+      , m_is_left(other.m_is_left)
+    {
+      reset_state(other.m_state.top);
+    }
+
+    iterator& operator=(const iterator& other) noexcept
+    {
+      m_tree = other.m_tree;
+      m_node = other.m_node;
+      m_stack = other.m_stack;
+      m_is_left = other.m_is_left;
+      reset_state(other.m_state.top);
+      return *this;
+    }
+
+    reference operator*() const noexcept
+    {
+      __ASSERT_NO_MSG(m_node != nullptr);
+      return *to_item(m_node);
+    }
+
+    pointer operator->() const noexcept
+    {
+      __ASSERT_NO_MSG(m_node != nullptr);
+      return to_item(m_node);
+    }
+
+    iterator& operator++() noexcept
+    {
+      __ASSERT_NO_MSG(m_node != nullptr);
+      m_node = z_rb_foreach_next(m_tree, &m_state);
+      return *this;
+    }
+
+    iterator operator++(int) noexcept
+    {
+      auto tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    friend bool operator==(const iterator& lhs, const iterator& rhs) noexcept
+    {
+      return lhs.m_node == rhs.m_node;
+    }
+
+    friend bool operator!=(const iterator& lhs, const iterator& rhs) noexcept
+    {
+      return lhs.m_node != rhs.m_node;
+    }
+
+    friend bool operator==(const iterator& lhs, std::default_sentinel_t) noexcept
+    {
+      return lhs.m_node == nullptr;
+    }
+  private:
+    void reset_state(int32_t top) noexcept
+    {
+      m_state.stack = m_stack.data();
+      m_state.is_left = m_is_left.data();
+      m_state.top = top;
+    }
+  private:
+    struct rbtree*                                 m_tree{ nullptr };
+    rbnode*                                        m_node{ nullptr };
+    std::array<rbnode*, Z_MAX_RBTREE_DEPTH>        m_stack{};
+    std::array<uint8_t, Z_MAX_RBTREE_DEPTH>        m_is_left{};
+    struct _rb_foreach                             m_state{};
+  };
+public:
+  ///
+  /// @brief create an empty tree
+  ///
+  intrusive_rbtree() noexcept
+  {
+    m_tree.lessthan_fn = &less_than;
+  }
+
+  ///
+  /// @brief get an iterator to the smallest object
+  ///
+  /// @return iterator to the smallest object
+  ///
+  [[nodiscard]] iterator begin() noexcept
+  {
+    return iterator(&m_tree);
+  }
+
+  ///
+  /// @brief get the end of the tree
+  ///
+  /// @return a sentinel that compares equal to an iterator past the
+  ///         largest object
+  ///
+  [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept
+  {
+    return std::default_sentinel;
+  }
+
+  ///
+  /// @brief check if the tree is empty
+  ///
+  /// @return true if the tree is empty
+  ///
+  [[nodiscard]] bool empty() const noexcept
+  {
+    return m_tree.root == nullptr;
+  }
+
+  ///
+  /// @brief count the objects in the tree, this is O(n)
+  ///
+  /// @return the number of objects
+  ///
+  [[nodiscard]] size_type size() noexcept
+  {
+    size_type n = 0;
+    for (auto it = begin(); it != end(); ++it) {
+      n++;
+    }
+    return n;
+  }
+
+  ///
+  /// @brief add an object to the tree
+  ///
+  /// @param item the object to add, must not be in a tree
+  ///
+  void insert(reference item) noexcept
+  {
+    rb_insert(&m_tree, &(item.*T_Node));
+  }
+
+  ///
+  /// @brief remove an object from the tree
+  ///
+  /// @param item the object to remove, must be in this tree
+  ///
+  void erase(reference item) noexcept
+  {
+    rb_remove(&m_tree, &(item.*T_Node));
+  }
+
+  ///
+  /// @brief check if an object is in the tree
+  ///
+  /// @param item the object to look for
+  ///
+  /// @return true if @a item itself is in the tree
+  ///
+  [[nodiscard]] bool contains(reference item) noexcept
+  {
+    return rb_contains(&m_tree, &(item.*T_Node));
+  }
+
+  ///
+  /// @brief get the smallest object
+  ///
+  /// @return the smallest object or nullptr when the tree is empty
+  ///
+  [[nodiscard]] pointer min() noexcept
+  {
+    return to_item(rb_get_min(&m_tree));
+  }
+
+  ///
+  /// @brief get the largest object
+  ///
+  /// @return the largest object or nullptr when the tree is empty
+  ///
+  [[nodiscard]] pointer max() noexcept
+  {
+    return to_item(rb_get_max(&m_tree));
+  }
+
+  ///
+  /// @brief find an object that compares equal to a key in O(log n)
+  ///
+  /// @param key the key, compare_type must be able to compare it with
+  ///        @a T_Item both ways
+  ///
+  /// @return an object equal to @a key or nullptr
+  ///
+  template<class T_Key>
+  [[nodiscard]] pointer find(const T_Key& key) noexcept
+  {
+    compare_type comp{};
+
+    auto n = m_tree.root;
+    while (n != nullptr) {
+      auto item = to_item(n);
+      if (comp(key, *item)) {
+        n = z_rb_child(n, 0);
+      } else if (comp(*item, key)) {
+        n = z_rb_child(n, 1);
+      } else {
+        return item;
+      }
+    }
+
+    return nullptr;
+  }
+
+  ///
+  /// @brief find the smallest object that is not less than a key
+  ///        in O(log n)
+  ///
+  /// @param key the key, compare_type must be able to compare it with
+  ///        @a T_Item both ways
+  ///
+  /// @return the object or nullptr when all objects are less than @a key
+  ///
+  template<class T_Key>
+  [[nodiscard]] pointer lower_bound(const T_Key& key) noexcept
+  {
+    compare_type comp{};
+    pointer res{ nullptr };
+
+    auto n = m_tree.root;
+    while (n != nullptr) {
+      auto item = to_item(n);
+      if (comp(*item, key)) {
+        n = z_rb_child(n, 1);
+      } else {
+        res = item;
+        n = z_rb_child(n, 0);
+      }
+    }
+
+    return res;
+  }
+
+  ///
+  /// @brief get the Zephyr native tree
+  ///
+  /// @return pointer to the rbtree
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return &m_tree;
+  }
+
+  ///
+  /// @brief get the Zephyr native tree
+  ///
+  /// @return pointer to the rbtree
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return &m_tree;
+  }
+private:
+  static pointer to_item(rbnode* node) noexcept
+  {
+    return internal::container_of(node, T_Node);
+  }
+
+  static bool less_than(rbnode* a, rbnode* b) noexcept
+  {
+    return compare_type{}(*to_item(a), *to_item(b));
+  }
+private:
+  native_type m_tree{};
+public:
+  intrusive_rbtree(const intrusive_rbtree&) = delete;
+  intrusive_rbtree(intrusive_rbtree&&) = delete;
+  intrusive_rbtree& operator=(const intrusive_rbtree&) = delete;
+  intrusive_rbtree& operator=(intrusive_rbtree&&) = delete;
+};
+
+} // namespace zpp
+
+#endif // ZPP_INCLUDE_ZPP_INTRUSIVE_RBTREE_HPP
@@ -0,0 +1,284 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_INTRUSIVE_SLIST_HPP
+#define ZPP_INCLUDE_ZPP_INTRUSIVE_SLIST_HPP
+
+#include <zpp/utils.hpp>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/slist.h>
+
+#include <cstddef>
+#include <iterator>
+
+namespace zpp {
+
+///
+/// @brief Singly linked list of objects containing a sys_snode_t
+///
+/// The list never allocates, the objects are linked through their
+/// @a T_Node member. An object can be in one list per node member.
+///
+/// @param T_Item the type of the objects in the list
+/// @param T_Node pointer to the sys_snode_t member of @a T_Item
+///
+template<typename T_Item, sys_snode_t T_Item::* T_Node>
+class intrusive_slist {
+public:
+  using native_type = sys_slist_t;
+  using native_pointer = native_type *;
+  using native_const_pointer = native_type const *;
+
+  using value_type = T_Item;
+  using reference = T_Item&;
+  using pointer = T_Item*;
+  using size_type = size_t;
+
+  ///
+  /// @brief forward iterator over the list
+  ///
+  class iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T_Item;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T_Item*;
+    using reference = T_Item&;
+  public:
+    constexpr iterator() noexcept = default;
+
+    constexpr explicit iterator(sys_snode_t* node) noexcept
+      : m_node(node)
+    {
+    }
+
+    reference operator*() const noexcept
+    {
+      __ASSERT_NO_MSG(m_node != nullptr);
+      return *to_item(m_node);
+    }
+
+    pointer operator->() const noexcept
+    {
+      __ASSERT_NO_MSG(m_node != nullptr);
+      return to_item(m_node);
+    }
+
+    iterator& operator++() noexcept
+    {
+      __ASSERT_NO_MSG(m_node != nullptr);
+      m_node = sys_slist_peek_next_no_check(m_node);
+      return *this;
+    }
+
+    iterator operator++(int) noexcept
+    {
+      auto tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    friend constexpr bool operator==(const iterator& lhs, const iterator& rhs) noexcept
+    {
+      return lhs.m_node == rhs.m_node;
+    }
+
+    friend constexpr bool operator!=(const iterator& lhs, const iterator& rhs) noexcept
+    {
+      return lhs.m_node != rhs.m_node;
+    }
+
+    ///
+    /// @brief get the node the iterator points to
+    ///
+    /// @return pointer to the node, nullptr for the end iterator
+    ///
+    constexpr sys_snode_t* native_handle() const noexcept
+    {
+      return m_node;
+    }
+  private:
+    sys_snode_t* m_node{ nullptr };
+  };
+public:
+  ///
+  /// @brief create an empty list
+  ///
+  intrusive_slist() noexcept
+  {
+    sys_slist_init(&m_list);
+  }
+
+  ///
+  /// @brief get an iterator to the first object
+  ///
+  /// @return iterator to the first object
+  ///
+  [[nodiscard]] iterator begin() noexcept
+  {
+    return iterator(sys_slist_peek_head(&m_list));
+  }
+
+  ///
+  /// @brief get the end iterator
+  ///
+  /// @return the end iterator
+  ///
+  [[nodiscard]] iterator end() noexcept
+  {
+    return iterator();
+  }
+
+  ///
+  /// @brief check if the list is empty
+  ///
+  /// @return true if the list is empty
+  ///
+  [[nodiscard]] bool empty() noexcept
+  {
+    return sys_slist_is_empty(&m_list);
+  }
+
+  ///
+  /// @brief count the objects in the list, this is O(n)
+  ///
+  /// @return the number of objects
+  ///
+  [[nodiscard]] size_type size() noexcept
+  {
+    return sys_slist_len(&m_list);
+  }
+
+  ///
+  /// @brief get the first object
+  ///
+  /// @return the first object or nullptr when the list is empty
+  ///
+  [[nodiscard]] pointer front() noexcept
+  {
+    return to_item(sys_slist_peek_head(&m_list));
+  }
+
+  ///
+  /// @brief get the last object
+  ///
+  /// @return the last object or nullptr when the list is empty
+  ///
+  [[nodiscard]] pointer back() noexcept
+  {
+    return to_item(sys_slist_peek_tail(&m_list));
+  }
+
+  ///
+  /// @brief add an object at the front of the list
+  ///
+  /// @param item the object to add, must not be in a list
+  ///
+  void push_front(reference item) noexcept
+  {
+    sys_slist_prepend(&m_list, &(item.*T_Node));
+  }
+
+  ///
+  /// @brief add an object at the back of the list
+  ///
+  /// @param item the object to add, must not be in a list
+  ///
+  void push_back(reference item) noexcept
+  {
+    sys_slist_append(&m_list, &(item.*T_Node));
+  }
+
+  ///
+  /// @brief add an object after another object
+  ///
+  /// @param pos the object to insert after, must be in this list
+  /// @param item the object to add, must not be in a list
+  ///
+  void insert_after(reference pos, reference item) noexcept
+  {
+    sys_slist_insert(&m_list, &(pos.*T_Node), &(item.*T_Node));
+  }
+
+  ///
+  /// @brief remove the first object
+  ///
+  /// @return the removed object or nullptr when the list is empty
+  ///
+  pointer pop_front() noexcept
+  {
+    return to_item(sys_slist_get(&m_list));
+  }
+
+  ///
+  /// @brief remove an object, this is O(n)
+  ///
+  /// @param item the object to remove
+  ///
+  /// @return true if @a item was in the list
+  ///
+  bool remove(reference item) noexcept
+  {
+    return sys_slist_find_and_remove(&m_list, &(item.*T_Node));
+  }
+
+  ///
+  /// @brief move all objects of another list to the back of this list
+  ///
+  /// @param other the list to take the objects from, empty afterwards
+  ///
+  void splice(intrusive_slist& other) noexcept
+  {
+    __ASSERT_NO_MSG(&other != this);
+    sys_slist_merge_slist(&m_list, &other.m_list);
+  }
+
+  ///
+  /// @brief remove all objects from the list
+  ///
+  void clear() noexcept
+  {
+    sys_slist_init(&m_list);
+  }
+
+  ///
+  /// @brief get the Zephyr native list
+  ///
+  /// @return pointer to the sys_slist_t
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return &m_list;
+  }
+
+  ///
+  /// @brief get the Zephyr native list
+  ///
+  /// @return pointer to the sys_slist_t
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return &m_list;
+  }
+private:
+  static pointer to_item(sys_snode_t* node) noexcept
+  {
+    return internal::container_of(node, T_Node);
+  }
+private:
+  native_type m_list;
+public:
+  intrusive_slist(const intrusive_slist&) = delete;
+  intrusive_slist(intrusive_slist&&) = delete;
+  intrusive_slist& operator=(const intrusive_slist&) = delete;
+  intrusive_slist& operator=(intrusive_slist&&) = delete;
+};
+
+} // namespace zpp
+
+#endif // ZPP_INCLUDE_ZPP_INTRUSIVE_SLIST_HPP
@@ -0,0 +1,372 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_LATENCY_HISTOGRAM_HPP
+#define ZPP_INCLUDE_ZPP_LATENCY_HISTOGRAM_HPP
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include <zpp/atomic_var.hpp>
+#include <zpp/clock.hpp>
+#include <zpp/fmt.hpp>
+
+namespace zpp {
+
+///
+/// @brief Lock-free histogram of latencies using log2 buckets
+///
+/// Bucket @a n counts the samples of at least 2^n and less than 2^(n+1)
+/// nanoseconds, the last bucket also counts everything larger. Recording
+/// a sample only uses atomic operations so it is safe to do from any
+/// thread or ISR.
+///
+/// @param T_Buckets the number of log2 buckets
+///
+template<size_t T_Buckets = 32>
+class latency_histogram {
+  static_assert(T_Buckets > 0);
+  static_assert(T_Buckets <= 64);
+public:
+  using duration = std::chrono::nanoseconds;
+  using counter_type = atomic_var::value_type;
+public:
+  ///
+  /// @brief default constructor creating an empty histogram
+  ///
+  constexpr latency_histogram() noexcept = default;
+
+  ///
+  /// @brief the number of buckets
+  ///
+  /// @return the number of buckets
+  ///
+  static constexpr size_t bucket_count() noexcept
+  {
+    return T_Buckets;
+  }
+
+  ///
+  /// @brief get the bucket index for a sample
+  ///
+  /// @param d the sample
+  ///
+  /// @return the index of the bucket @a d is counted in
+  ///
+  template<class T_Rep, class T_Period>
+  static constexpr size_t
+  bucket_index(const std::chrono::duration<T_Rep, T_Period>& d) noexcept
+  {
+    using namespace std::chrono;
+
+    auto ns = duration_cast<nanoseconds>(d).count();
+    if (ns <= 0) {
+      return 0;
+    }
+
+    size_t idx = std::bit_width(static_cast<uint64_t>(ns)) - 1;
+    if (idx >= T_Buckets) {
+      idx = T_Buckets - 1;
+    }
+
+    return idx;
+  }
+
+  ///
+  /// @brief get the lower bound of a bucket
+  ///
+  /// @param idx the bucket index
+  ///
+  /// @return the smallest sample counted in bucket @a idx
+  ///
+  static constexpr duration bucket_lower_bound(size_t idx) noexcept
+  {
+    __ASSERT_NO_MSG(idx < T_Buckets);
+    return duration(idx == 0 ? 0 : (int64_t(1) << idx));
+  }
+
+  ///
+  /// @brief get the upper bound of a bucket
+  ///
+  /// @param idx the bucket index
+  ///
+  /// @return the first sample value not counted in bucket @a idx,
+  ///         duration::max() for the last bucket
+  ///
+  static constexpr duration bucket_upper_bound(size_t idx) noexcept
+  {
+    __ASSERT_NO_MSG(idx < T_Buckets);
+    if (idx + 1 >= T_Buckets || idx >= 62) {
+      return duration::max();
+    }
+    return duration(int64_t(1) << (idx + 1));
+  }
+
+  ///
+  /// @brief record a sample
+  ///
+  /// @param d the latency to record
+  ///
+  template<class T_Rep, class T_Period>
+  void record(const std::chrono::duration<T_Rep, T_Period>& d) noexcept
+  {
+    using namespace std::chrono;
+
+    m_buckets[bucket_index(d)].fetch_inc();
+    m_count.fetch_inc();
+
+    auto ns = to_counter(duration_cast<nanoseconds>(d));
+
+    auto cur = m_max.load();
+    while (ns > cur && !m_max.cas(cur, ns)) {
+      cur = m_max.load();
+    }
+
+    // m_min_rev holds the distance to the largest counter value, so
+    // a zero initialized histogram has the largest possible minimum
+    auto rev = std::numeric_limits<counter_type>::max() - ns;
+
+    cur = m_min_rev.load();
+    while (rev > cur && !m_min_rev.cas(cur, rev)) {
+      cur = m_min_rev.load();
+    }
+  }
+
+  ///
+  /// @brief reset the histogram to the empty state
+  ///
+  void reset() noexcept
+  {
+    for (auto& b: m_buckets) {
+      b.clear();
+    }
+
+    m_count.clear();
+    m_max.clear();
+    m_min_rev.clear();
+  }
+
+  ///
+  /// @brief get the number of recorded samples
+  ///
+  /// @return the number of recorded samples
+  ///
+  [[nodiscard]] counter_type count() const noexcept
+  {
+    return m_count.load();
+  }
+
+  ///
+  /// @brief get the number of samples in a bucket
+  ///
+  /// @param idx the bucket index
+  ///
+  /// @return the number of samples counted in bucket @a idx
+  ///
+  [[nodiscard]] counter_type bucket(size_t idx) const noexcept
+  {
+    __ASSERT_NO_MSG(idx < T_Buckets);
+    return m_buckets[idx].load();
+  }
+
+  ///
+  /// @brief get the smallest recorded sample
+  ///
+  /// @return the smallest sample or zero when the histogram is empty
+  ///
+  [[nodiscard]] duration min() const noexcept
+  {
+    if (count() == 0) {
+      return duration::zero();
+    }
+    return duration(std::numeric_limits<counter_type>::max() - m_min_rev.load());
+  }
+
+  ///
+  /// @brief get the largest recorded sample
+  ///
+  /// @return the largest sample or zero when the histogram is empty
+  ///
+  [[nodiscard]] duration max() const noexcept
+  {
+    return duration(m_max.load());
+  }
+
+  ///
+  /// @brief get an upper bound for a percentile
+  ///
+  /// The result is the upper bound of the bucket the percentile falls in,
+  /// limited to the largest recorded sample.
+  ///
+  /// @param pct the percentile, from 0 to 100
+  ///
+  /// @return the latency that @a pct percent of the samples did not exceed
+  ///
+  [[nodiscard]] duration percentile(uint32_t pct) const noexcept
+  {
+    __ASSERT_NO_MSG(pct <= 100);
+
+    uint64_t total = 0;
+    for (auto& b: m_buckets) {
+      total += static_cast<uint64_t>(b.load());
+    }
+
+    if (total == 0) {
+      return duration::zero();
+    }
+
+    uint64_t needed = (total * pct + 99) / 100;
+    if (needed == 0) {
+      needed = 1;
+    }
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < T_Buckets; ++i) {
+      seen += static_cast<uint64_t>(m_buckets[i].load());
+      if (seen >= needed) {
+        auto ub = bucket_upper_bound(i);
+        return (ub < max()) ? ub : max();
+      }
+    }
+
+    return max();
+  }
+
+  ///
+  /// @brief print a summary and all non empty buckets using zpp::print
+  ///
+  /// @param name the name to print in front of the summary
+  ///
+  void print(const char* name) const noexcept
+  {
+    zpp::print("{}: count={} min={} p50={} p99={} max={}\n",
+      name, static_cast<uint64_t>(count()),
+      min(), percentile(50), percentile(99), max());
+
+    for (size_t i = 0; i < T_Buckets; ++i) {
+      auto n = bucket(i);
+      if (n == 0) {
+        continue;
+      }
+
+      if (i + 1 < T_Buckets) {
+        zpp::print("  [{} .. {}) {}\n",
+          bucket_lower_bound(i), bucket_upper_bound(i),
+          static_cast<uint64_t>(n));
+      } else {
+        zpp::print("  [{} .. ) {}\n",
+          bucket_lower_bound(i), static_cast<uint64_t>(n));
+      }
+    }
+  }
+private:
+  static counter_type to_counter(duration d) noexcept
+  {
+    if (d.count() <= 0) {
+      return 0;
+    }
+
+    if (static_cast<uint64_t>(d.count()) >
+        static_cast<uint64_t>(std::numeric_limits<counter_type>::max()))
+    {
+      return std::numeric_limits<counter_type>::max();
+    }
+
+    return static_cast<counter_type>(d.count());
+  }
+private:
+  std::array<atomic_var, T_Buckets> m_buckets{};
+  atomic_var                        m_count{};
+  atomic_var                        m_max{};
+  atomic_var                        m_min_rev{};
+public:
+  latency_histogram(const latency_histogram&) = delete;
+  latency_histogram(latency_histogram&&) = delete;
+  latency_histogram& operator=(const latency_histogram&) = delete;
+  latency_histogram& operator=(latency_histogram&&) = delete;
+};
+
+#ifdef CONFIG_ZPP_LATENCY_PROBES
+
+///
+/// @brief RAII probe recording the time spent in a scope
+///
+/// The cycle_clock is sampled when the probe is created and when it
+/// is destroyed, the difference is recorded in the histogram.
+///
+/// @param T_Histogram the histogram type to record into
+///
+template<class T_Histogram>
+class scoped_probe {
+public:
+  ///
+  /// @brief start measuring
+  ///
+  /// @param h the histogram the latency will be recorded in
+  ///
+  explicit scoped_probe(T_Histogram& h) noexcept
+    : m_histogram(h)
+    , m_start(cycle_clock::now())
+  {
+  }
+
+  ///
+  /// @brief stop measuring and record the latency
+  ///
+  ~scoped_probe() noexcept
+  {
+    auto end = cycle_clock::now();
+
+    // the cycle counter wrapped, the sample is useless
+    if (end >= m_start) {
+      m_histogram.record(end - m_start);
+    }
+  }
+private:
+  T_Histogram&            m_histogram;
+  cycle_clock::time_point m_start;
+public:
+  scoped_probe() = delete;
+  scoped_probe(const scoped_probe&) = delete;
+  scoped_probe(scoped_probe&&) = delete;
+  scoped_probe& operator=(const scoped_probe&) = delete;
+  scoped_probe& operator=(scoped_probe&&) = delete;
+};
+
+#else // CONFIG_ZPP_LATENCY_PROBES
+
+///
+/// @brief RAII probe that does nothing because CONFIG_ZPP_LATENCY_PROBES
+///        is not enabled
+///
+/// @param T_Histogram the histogram type to record into
+///
+template<class T_Histogram>
+class scoped_probe {
+public:
+  explicit constexpr scoped_probe(T_Histogram&) noexcept
+  {
+  }
+public:
+  scoped_probe() = delete;
+  scoped_probe(const scoped_probe&) = delete;
+  scoped_probe(scoped_probe&&) = delete;
+  scoped_probe& operator=(const scoped_probe&) = delete;
+  scoped_probe& operator=(scoped_probe&&) = delete;
+};
+
+#endif // CONFIG_ZPP_LATENCY_PROBES
+
+} // namespace zpp
+
+#endif // ZPP_INCLUDE_ZPP_LATENCY_HISTOGRAM_HPP
@@ -0,0 +1,343 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_LIFO_HPP
+#define ZPP_INCLUDE_ZPP_LIFO_HPP
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+
+#include <zpp/clock.hpp>
+
+#include <chrono>
+#include <limits>
+#include <type_traits>
+#include <cstddef>
+
+namespace zpp {
+
+namespace internal {
+
+template<typename T_Item>
+constexpr bool has_lifo_reserved_v = requires { T_Item::lifo_reserved; };
+
+template<typename T_Item>
+constexpr bool lifo_item_ok() noexcept
+{
+  if constexpr (has_lifo_reserved_v<T_Item>) {
+    return std::is_same_v<void*, decltype(T_Item::lifo_reserved)>
+        && offsetof(T_Item, lifo_reserved) == 0;
+  } else {
+    return std::is_same_v<void*, decltype(T_Item::fifo_reserved)>
+        && offsetof(T_Item, fifo_reserved) == 0;
+  }
+}
+
+} // namespace internal
+
+///
+/// @brief Lifo CRTP base class
+///
+/// The last item pushed is the first one popped, which makes a lifo a
+/// good free list: the buffer handed out is the one released most
+/// recently and is the most likely to still be in the cache.
+///
+/// Items need a void* as first member called lifo_reserved, or
+/// fifo_reserved so the same item type can be used with a fifo.
+///
+/// @param T_BaseLifoType the CRTP derived type
+/// @param T_BaseItemType the item to store in this lifo
+///
+template<template<typename> typename T_BaseLifoType, typename T_BaseItemType>
+class lifo_base {
+public:
+  using native_type = struct k_lifo;
+  using native_pointer = native_type *;
+  using native_const_pointer = native_type const *;
+
+  using item_type = T_BaseItemType;
+  using item_pointer = item_type*;
+  using item_const_pointer = item_type const *;
+protected:
+  ///
+  /// @brief default constructor, can only be called from derived types
+  ///
+  lifo_base() noexcept
+  {
+    static_assert(std::is_standard_layout_v<item_type>);
+    static_assert(internal::lifo_item_ok<item_type>(),
+                  "item needs a void* lifo_reserved or fifo_reserved first member");
+  }
+public:
+  ///
+  /// @brief get the Zephyr native lifo handle
+  ///
+  /// @return pointer to a k_lifo
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return static_cast<T_BaseLifoType<item_type>*>(this)->native_handle();
+  }
+
+  ///
+  /// @brief get the Zephyr native lifo handle
+  ///
+  /// @return pointer to a k_lifo
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return static_cast<const T_BaseLifoType<item_type>*>(this)->native_handle();
+  }
+
+  ///
+  /// @brief force a waiting thread to return with a timeout error
+  ///
+  void cancel_wait() noexcept
+  {
+    k_queue_cancel_wait(&native_handle()->_queue);
+  }
+
+  ///
+  /// @brief push an item on the top of the lifo
+  ///
+  /// @param item Pointer to a item, the lifo does not take ownership
+  ///
+  void push(item_pointer item) noexcept
+  {
+    k_lifo_put(native_handle(), item);
+  }
+
+  ///
+  /// @brief pop the top item from lifo waiting for ever
+  ///
+  /// @return the item or nullptr on error
+  ///
+  [[nodiscard]] item_pointer
+  pop() noexcept
+  {
+    return static_cast<item_pointer>(
+      k_lifo_get(native_handle(), K_FOREVER));
+  }
+
+  ///
+  /// @brief try to pop the top item from the lifo without waiting
+  ///
+  /// @return the item or nullptr on error/timeout
+  ///
+  [[nodiscard]] item_pointer
+  try_pop() noexcept
+  {
+    return static_cast<item_pointer>(
+      k_lifo_get(native_handle(), K_NO_WAIT));
+  }
+
+  ///
+  /// @brief try to pop the top item from the lifo waiting a certain amount of time
+  ///
+  /// @param timeout The timeout before returning
+  ///
+  /// @return the item or nullptr on error/timeout
+  ///
+  template <class T_Rep, class T_Period>
+  [[nodiscard]] item_pointer
+  try_pop_for(const std::chrono::duration<T_Rep, T_Period>& timeout) noexcept
+  {
+    return static_cast<item_pointer>(
+      k_lifo_get(native_handle(), to_timeout(timeout)));
+  }
+
+  ///
+  /// @brief try to pop the top item from the lifo waiting until a certain time
+  ///
+  /// @param abs_time The time point to wait until
+  ///
+  /// @return the item or nullptr on error/timeout
+  ///
+  template <class T_Clock, class T_Duration>
+  [[nodiscard]] item_pointer
+  try_pop_until(const std::chrono::time_point<T_Clock, T_Duration>& abs_time) noexcept
+  {
+    return static_cast<item_pointer>(
+      k_lifo_get(native_handle(), to_timeout(abs_time)));
+  }
+
+  ///
+  /// @brief get the top item without removing it from the lifo
+  ///
+  /// @return the item or nullptr when the lifo is empty
+  ///
+  [[nodiscard]] item_pointer
+  top() noexcept
+  {
+    return static_cast<item_pointer>(
+      k_queue_peek_head(&native_handle()->_queue));
+  }
+
+  ///
+  /// @brief check if the lifo is empty
+  ///
+  /// @return true if the lifo is empty
+  ///
+  [[nodiscard]] bool empty() noexcept
+  {
+    auto res  = k_queue_is_empty(&native_handle()->_queue);
+    if (res == 0) {
+      return false;
+    } else {
+      return true;
+    }
+  }
+public:
+  lifo_base(const lifo_base&) = delete;
+  lifo_base(lifo_base&&) = delete;
+  lifo_base& operator=(const lifo_base&) = delete;
+  lifo_base& operator=(lifo_base&&) = delete;
+};
+
+///
+/// @brief lifo that manages a k_lifo object
+///
+template<typename T_ItemType>
+class lifo : public lifo_base<lifo, T_ItemType> {
+public:
+  using typename lifo_base<lifo, T_ItemType>::native_type;
+  using typename lifo_base<lifo, T_ItemType>::native_pointer;
+  using typename lifo_base<lifo, T_ItemType>::native_const_pointer;
+public:
+  ///
+  /// @brief create new lifo
+  ///
+  lifo() noexcept
+  {
+    k_lifo_init(&m_lifo);
+  }
+
+  ///
+  /// @brief get the Zephyr native lifo handle
+  ///
+  /// @return pointer to a k_lifo
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return &m_lifo;
+  }
+
+  ///
+  /// @brief get the Zephyr native lifo handle
+  ///
+  /// @return pointer to a k_lifo
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return &m_lifo;
+  }
+private:
+  native_type m_lifo;
+public:
+  lifo(const lifo&) = delete;
+  lifo(lifo&&) = delete;
+  lifo& operator=(const lifo&) = delete;
+  lifo& operator=(lifo&&) = delete;
+};
+
+///
+/// @brief lifo that references a k_lifo object
+///
+template<typename T_ItemType>
+class lifo_ref : public lifo_base<lifo_ref, T_ItemType> {
+public:
+  using typename lifo_base<lifo_ref, T_ItemType>::native_type;
+  using typename lifo_base<lifo_ref, T_ItemType>::native_pointer;
+  using typename lifo_base<lifo_ref, T_ItemType>::native_const_pointer;
+public:
+  ///
+  /// @brief wrap k_lifo
+  ///
+  /// @param f the k_lifo to reference
+  ///
+  /// @warning @a f must stay valid for the lifetime of this object
+  ///
+  constexpr explicit lifo_ref(native_pointer f) noexcept
+    : m_lifo_ptr(f)
+  {
+    __ASSERT_NO_MSG(m_lifo_ptr != nullptr);
+  }
+
+  ///
+  /// @brief Reference another lifo object
+  ///
+  /// @param f the object to reference
+  ///
+  /// @warning @a f must stay valid for the lifetime of this object
+  ///
+  template<template<class> class T_Lifo>
+  constexpr explicit lifo_ref(T_Lifo<T_ItemType>& f) noexcept
+    : m_lifo_ptr(f.native_handle())
+  {
+    __ASSERT_NO_MSG(m_lifo_ptr != nullptr);
+  }
+
+  ///
+  /// @brief Reference another lifo object
+  ///
+  /// @param f the object to reference
+  ///
+  /// @return *this
+  ///
+  /// @warning @a f must stay valid for the lifetime of this object
+  ///
+  constexpr lifo_ref& operator=(native_pointer f) noexcept
+  {
+    m_lifo_ptr = f;
+    __ASSERT_NO_MSG(m_lifo_ptr != nullptr);
+    return *this;
+  }
+
+  ///
+  /// @brief Reference another lifo object
+  ///
+  /// @param f the object to reference
+  ///
+  /// @return *this
+  ///
+  /// @warning @a f must stay valid for the lifetime of this object
+  ///
+  template<template<class> class T_Lifo>
+  constexpr lifo_ref& operator=(const T_Lifo<T_ItemType>& f) noexcept
+  {
+    m_lifo_ptr = f.native_handle();
+    __ASSERT_NO_MSG(m_lifo_ptr != nullptr);
+    return *this;
+  }
+
+  ///
+  /// @brief get the Zephyr native lifo handle
+  ///
+  /// @return pointer to a k_lifo
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return m_lifo_ptr;
+  }
+
+  ///
+  /// @brief get the Zephyr native lifo handle
+  ///
+  /// @return pointer to a k_lifo
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return m_lifo_ptr;
+  }
+private:
+  native_pointer m_lifo_ptr{ nullptr };
+public:
+  lifo_ref() = delete;
+};
+
+} // namespace zpp
+
+#endif // ZPP_INCLUDE_ZPP_LIFO_HPP
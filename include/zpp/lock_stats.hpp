@@ -0,0 +1,396 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_LOCK_STATS_HPP
+#define ZPP_INCLUDE_ZPP_LOCK_STATS_HPP
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/slist.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <zpp/fmt.hpp>
+
+namespace zpp {
+
+///
+/// @brief the kind of primitive a lock_stats object belongs to
+///
+enum class lock_kind : uint8_t {
+  mutex,
+  sys_mutex,
+  sem,
+  condition_variable,
+};
+
+///
+/// @brief Helper to output the lock kind with zpp::print("{}", kind)
+///
+/// @param kind The kind to print
+///
+inline void print_arg(lock_kind kind) noexcept
+{
+  switch (kind) {
+  case lock_kind::mutex:
+    printk("mutex");
+    break;
+  case lock_kind::sys_mutex:
+    printk("sys_mutex");
+    break;
+  case lock_kind::sem:
+    printk("sem");
+    break;
+  case lock_kind::condition_variable:
+    printk("condition_variable");
+    break;
+  }
+}
+
+///
+/// @brief copy of the statistics of one instrumented primitive
+///
+struct lock_stats_snapshot {
+  const void*               object{ nullptr };
+  const char*               name{ nullptr };
+  lock_kind                 kind{ lock_kind::mutex };
+  uint32_t                  acquisitions{ 0 };
+  uint32_t                  contended{ 0 };
+  std::chrono::nanoseconds  total_wait{ 0 };
+  std::chrono::nanoseconds  max_wait{ 0 };
+  std::chrono::nanoseconds  total_hold{ 0 };
+  std::chrono::nanoseconds  max_hold{ 0 };
+};
+
+///
+/// @brief lock statistics policy that records nothing
+///
+/// This is the policy used when CONFIG_ZPP_LOCK_STATS is disabled, it has
+/// no state and all its functions are empty so it adds no overhead.
+///
+class no_lock_stats {
+public:
+  static constexpr bool enabled = false;
+
+  explicit constexpr no_lock_stats(lock_kind, const void*) noexcept
+  {
+  }
+
+  ///
+  /// @brief set the name used in reports, ignored
+  ///
+  constexpr void set_name(const char*) noexcept
+  {
+  }
+public:
+  no_lock_stats() = delete;
+  no_lock_stats(const no_lock_stats&) = delete;
+  no_lock_stats(no_lock_stats&&) = delete;
+  no_lock_stats& operator=(const no_lock_stats&) = delete;
+  no_lock_stats& operator=(no_lock_stats&&) = delete;
+};
+
+class lock_stats;
+
+namespace internal {
+
+///
+/// @brief list of all lock_stats objects
+///
+struct lock_stats_registry {
+  sys_slist_t       list{};
+  struct k_spinlock lock{};
+};
+
+inline lock_stats_registry g_lock_stats_registry{};
+
+} // namespace internal
+
+///
+/// @brief lock statistics policy recording acquisitions, contention,
+///        wait time and hold time
+///
+/// Every lock_stats object registers itself in a global registry so
+/// all instrumented primitives can be enumerated with
+/// for_each_lock_stats() and print_lock_stats_top().
+///
+/// An acquisition is contended when the primitive was not available
+/// immediately. Hold time is only recorded for mutexes, for condition
+/// variables every wait is counted as a contended acquisition.
+///
+class lock_stats {
+public:
+  static constexpr bool enabled = true;
+
+  ///
+  /// @brief create and register the statistics of a primitive
+  ///
+  /// @param kind the kind of primitive
+  /// @param object the primitive, used to identify unnamed objects
+  ///
+  lock_stats(lock_kind kind, const void* object) noexcept
+    : m_object(object)
+    , m_kind(kind)
+  {
+    auto& reg = internal::g_lock_stats_registry;
+    auto key = k_spin_lock(&reg.lock);
+    sys_slist_append(&reg.list, &m_node);
+    k_spin_unlock(&reg.lock, key);
+  }
+
+  ///
+  /// @brief unregister the statistics
+  ///
+  ~lock_stats() noexcept
+  {
+    auto& reg = internal::g_lock_stats_registry;
+    auto key = k_spin_lock(&reg.lock);
+    sys_slist_find_and_remove(&reg.list, &m_node);
+    k_spin_unlock(&reg.lock, key);
+  }
+
+  ///
+  /// @brief set the name used in reports
+  ///
+  /// @param name the name, must stay valid for the lifetime of this object
+  ///
+  void set_name(const char* name) noexcept
+  {
+    m_name = name;
+  }
+
+  ///
+  /// @brief get a copy of the current statistics
+  ///
+  /// @return the current statistics
+  ///
+  [[nodiscard]] lock_stats_snapshot snapshot() const noexcept
+  {
+    lock_stats_snapshot s;
+
+    auto key = k_spin_lock(&m_lock);
+    s.object = m_object;
+    s.name = m_name;
+    s.kind = m_kind;
+    s.acquisitions = m_acquisitions;
+    s.contended = m_contended;
+    s.total_wait = to_ns(m_total_wait);
+    s.max_wait = to_ns(m_max_wait);
+    s.total_hold = to_ns(m_total_hold);
+    s.max_hold = to_ns(m_max_hold);
+    k_spin_unlock(&m_lock, key);
+
+    return s;
+  }
+
+  ///
+  /// @brief clear all counters
+  ///
+  void reset() noexcept
+  {
+    auto key = k_spin_lock(&m_lock);
+    m_acquisitions = 0;
+    m_contended = 0;
+    m_total_wait = 0;
+    m_max_wait = 0;
+    m_total_hold = 0;
+    m_max_hold = 0;
+    k_spin_unlock(&m_lock, key);
+  }
+
+  ///
+  /// @brief get a timestamp to pass to acquired()
+  ///
+  /// @return the current cycle count
+  ///
+  static uint32_t now() noexcept
+  {
+    return k_cycle_get_32();
+  }
+
+  ///
+  /// @brief record a successful acquisition
+  ///
+  /// @param start the timestamp taken before trying to acquire
+  /// @param contended true if the caller had to wait
+  ///
+  void acquired(uint32_t start, bool contended) noexcept
+  {
+    auto t = now();
+    uint32_t wait = t - start;
+
+    auto key = k_spin_lock(&m_lock);
+    m_acquisitions++;
+    if (contended) {
+      m_contended++;
+    }
+    m_total_wait += wait;
+    if (wait > m_max_wait) {
+      m_max_wait = wait;
+    }
+    k_spin_unlock(&m_lock, key);
+  }
+
+  ///
+  /// @brief record a successful mutex lock, starts the hold time
+  ///
+  /// @param start the timestamp taken before trying to lock
+  /// @param contended true if the caller had to wait
+  ///
+  void locked(uint32_t start, bool contended) noexcept
+  {
+    acquired(start, contended);
+
+    // only the owner gets here, so no locking is needed
+    if (m_depth++ == 0) {
+      m_owner = k_current_get();
+      m_hold_start = now();
+    }
+  }
+
+  ///
+  /// @brief record a mutex unlock, must be called before unlocking
+  ///
+  void unlocking() noexcept
+  {
+    if (m_owner != k_current_get() || m_depth == 0) {
+      return;
+    }
+
+    if (--m_depth != 0) {
+      return;
+    }
+
+    m_owner = nullptr;
+    uint32_t hold = now() - m_hold_start;
+
+    auto key = k_spin_lock(&m_lock);
+    m_total_hold += hold;
+    if (hold > m_max_hold) {
+      m_max_hold = hold;
+    }
+    k_spin_unlock(&m_lock, key);
+  }
+private:
+  static std::chrono::nanoseconds to_ns(uint64_t cycles) noexcept
+  {
+    return std::chrono::nanoseconds(k_cyc_to_ns_floor64(cycles));
+  }
+
+  template<class T_Callback>
+  friend void for_each_lock_stats(T_Callback&& cb) noexcept;
+private:
+  sys_snode_t               m_node{};
+  mutable struct k_spinlock m_lock{};
+  const void*               m_object{ nullptr };
+  const char*               m_name{ nullptr };
+  k_tid_t                   m_owner{ nullptr };
+  uint32_t                  m_depth{ 0 };
+  uint32_t                  m_hold_start{ 0 };
+  uint32_t                  m_acquisitions{ 0 };
+  uint32_t                  m_contended{ 0 };
+  uint64_t                  m_total_wait{ 0 };
+  uint32_t                  m_max_wait{ 0 };
+  uint64_t                  m_total_hold{ 0 };
+  uint32_t                  m_max_hold{ 0 };
+  lock_kind                 m_kind;
+public:
+  lock_stats() = delete;
+  lock_stats(const lock_stats&) = delete;
+  lock_stats(lock_stats&&) = delete;
+  lock_stats& operator=(const lock_stats&) = delete;
+  lock_stats& operator=(lock_stats&&) = delete;
+};
+
+#ifdef CONFIG_ZPP_LOCK_STATS
+///
+/// @brief the statistics policy used by mutex, sys_mutex, sem and
+///        condition_variable
+///
+using default_lock_stats = lock_stats;
+#else
+///
+/// @brief the statistics policy used by mutex, sys_mutex, sem and
+///        condition_variable
+///
+using default_lock_stats = no_lock_stats;
+#endif
+
+///
+/// @brief call a function for every registered lock_stats object
+///
+/// The callback is called with a lock_stats_snapshot while the registry
+/// is locked, so it must not block.
+///
+/// @param cb the callback to call
+///
+template<class T_Callback>
+void for_each_lock_stats(T_Callback&& cb) noexcept
+{
+  auto& reg = internal::g_lock_stats_registry;
+  auto key = k_spin_lock(&reg.lock);
+
+  for (auto n = sys_slist_peek_head(&reg.list); n != nullptr;
+        n = sys_slist_peek_next(n))
+  {
+    auto ls = reinterpret_cast<const lock_stats*>(
+        reinterpret_cast<const char*>(n) - offsetof(lock_stats, m_node));
+    cb(ls->snapshot());
+  }
+
+  k_spin_unlock(&reg.lock, key);
+}
+
+///
+/// @brief print the @a T_Count primitives with the highest total wait time
+///
+/// @param T_Count the maximum number of primitives to print
+///
+template<size_t T_Count = 10>
+void print_lock_stats_top() noexcept
+{
+  static_assert(T_Count > 0);
+
+  std::array<lock_stats_snapshot, T_Count> top{};
+  size_t used = 0;
+
+  for_each_lock_stats([&](const lock_stats_snapshot& s) noexcept {
+    size_t pos = used;
+    while (pos > 0 && top[pos - 1].total_wait < s.total_wait) {
+      pos--;
+    }
+
+    if (pos >= T_Count) {
+      return;
+    }
+
+    size_t last = (used < T_Count) ? used : T_Count - 1;
+    for (size_t i = last; i > pos; i--) {
+      top[i] = top[i - 1];
+    }
+    top[pos] = s;
+
+    if (used < T_Count) {
+      used++;
+    }
+  });
+
+  for (size_t i = 0; i < used; i++) {
+    const auto& s = top[i];
+    print("{} {} {}: acquisitions={} contended={} wait={} max_wait={} "
+          "hold={} max_hold={}\n",
+      s.kind, s.name != nullptr ? s.name : "<unnamed>", s.object,
+      s.acquisitions, s.contended, s.total_wait, s.max_wait,
+      s.total_hold, s.max_hold);
+  }
+}
+
+} // namespace zpp
+
+#endif // ZPP_INCLUDE_ZPP_LOCK_STATS_HPP
@@ -0,0 +1,471 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_MBOX_HPP
+#define ZPP_INCLUDE_ZPP_MBOX_HPP
+
+#include <zpp/clock.hpp>
+#include <zpp/result.hpp>
+#include <zpp/error_code.hpp>
+#include <zpp/thread_id.hpp>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace zpp {
+
+///
+/// @brief Result of a completed mailbox exchange
+///
+struct mbox_message_info {
+  ///
+  /// @brief number of bytes the receiver took
+  ///
+  size_t    size{ 0 };
+
+  ///
+  /// @brief the info value the other side passed
+  ///
+  uint32_t  info{ 0 };
+
+  ///
+  /// @brief the thread on the other side of the exchange
+  ///
+  thread_id peer{};
+};
+
+///
+/// @brief Mailbox CRTP base class
+///
+/// A mailbox exchanges messages between a sending and a receiving thread.
+/// The data is copied once, straight from the buffer of the sender into
+/// the buffer of the receiver, and a synchronous sender only returns
+/// after the receiver has taken the data, so a request/response exchange
+/// needs no intermediate buffers.
+///
+/// Both sides can restrict the exchange to a specific thread and pass
+/// a 32 bit info value to the other side.
+///
+/// @param T_Mbox the CRTP derived type
+///
+template<typename T_Mbox>
+class mbox_base {
+public:
+  using native_type = struct k_mbox;
+  using native_pointer = native_type *;
+  using native_const_pointer = native_type const *;
+protected:
+  ///
+  /// @brief default constructor, can only be called from derived types
+  ///
+  constexpr mbox_base() noexcept = default;
+public:
+  ///
+  /// @brief get the Zephyr native mailbox handle
+  ///
+  /// @return pointer to a k_mbox
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return static_cast<T_Mbox*>(this)->native_handle();
+  }
+
+  ///
+  /// @brief get the Zephyr native mailbox handle
+  ///
+  /// @return pointer to a k_mbox
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return static_cast<const T_Mbox*>(this)->native_handle();
+  }
+
+  ///
+  /// @brief send a message waiting forever for it to be received
+  ///
+  /// @param data the data to send
+  /// @param target the receiving thread, or thread_id::any()
+  /// @param info the info value to pass to the receiver
+  ///
+  /// @return the exchange info or an error code
+  ///
+  template<class T, size_t T_Extent>
+  [[nodiscard]] auto send(std::span<T, T_Extent> data,
+                          thread_id target = thread_id::any(),
+                          uint32_t info = 0) noexcept
+  {
+    return put(tx_bytes(data), target, info, K_FOREVER);
+  }
+
+  ///
+  /// @brief send a message if a receiver is waiting
+  ///
+  /// @param data the data to send
+  /// @param target the receiving thread, or thread_id::any()
+  /// @param info the info value to pass to the receiver
+  ///
+  /// @return the exchange info or an error code
+  ///
+  template<class T, size_t T_Extent>
+  [[nodiscard]] auto try_send(std::span<T, T_Extent> data,
+                              thread_id target = thread_id::any(),
+                              uint32_t info = 0) noexcept
+  {
+    return put(tx_bytes(data), target, info, K_NO_WAIT);
+  }
+
+  ///
+  /// @brief send a message waiting a certain amount of time for it to
+  ///        be received
+  ///
+  /// @param data the data to send
+  /// @param timeout the time to wait
+  /// @param target the receiving thread, or thread_id::any()
+  /// @param info the info value to pass to the receiver
+  ///
+  /// @return the exchange info or an error code
+  ///
+  template<class T, size_t T_Extent, class T_Rep, class T_Period>
+  [[nodiscard]] auto
+  try_send_for(std::span<T, T_Extent> data,
+               const std::chrono::duration<T_Rep, T_Period>& timeout,
+               thread_id target = thread_id::any(),
+               uint32_t info = 0) noexcept
+  {
+    return put(tx_bytes(data), target, info, to_timeout(timeout));
+  }
+
+  ///
+  /// @brief send a message waiting until a certain time for it to
+  ///        be received
+  ///
+  /// @param data the data to send
+  /// @param abs_time the time point to wait until
+  /// @param target the receiving thread, or thread_id::any()
+  /// @param info the info value to pass to the receiver
+  ///
+  /// @return the exchange info or an error code
+  ///
+  template<class T, size_t T_Extent, class T_Clock, class T_Duration>
+  [[nodiscard]] auto
+  try_send_until(std::span<T, T_Extent> data,
+                 const std::chrono::time_point<T_Clock, T_Duration>& abs_time,
+                 thread_id target = thread_id::any(),
+                 uint32_t info = 0) noexcept
+  {
+    return put(tx_bytes(data), target, info, to_timeout(abs_time));
+  }
+
+#if defined(CONFIG_NUM_MBOX_ASYNC_MSGS) && (CONFIG_NUM_MBOX_ASYNC_MSGS > 0)
+  ///
+  /// @brief send a message without waiting for it to be received
+  ///
+  /// @a done is given once the receiver has taken the data.
+  ///
+  /// @param data the data to send, must stay valid until @a done is given
+  /// @param done the semaphore to give when the message was received
+  /// @param target the receiving thread, or thread_id::any()
+  /// @param info the info value to pass to the receiver
+  ///
+  template<class T, size_t T_Extent, class T_Sem>
+  void async_send(std::span<T, T_Extent> data, T_Sem& done,
+                  thread_id target = thread_id::any(),
+                  uint32_t info = 0) noexcept
+  {
+    auto bytes = tx_bytes(data);
+
+    struct k_mbox_msg msg{};
+    msg.info = info;
+    msg.size = bytes.size();
+    msg.tx_data = const_cast<std::byte*>(bytes.data());
+    msg.tx_target_thread = target.native_handle();
+
+    k_mbox_async_put(native_handle(), &msg, done.native_handle());
+  }
+#endif // CONFIG_NUM_MBOX_ASYNC_MSGS
+
+  ///
+  /// @brief receive a message waiting forever
+  ///
+  /// When the message is larger than @a buffer the rest of the message
+  /// is discarded, the sender can see this in the returned size.
+  ///
+  /// @param buffer the buffer to receive into
+  /// @param source the sending thread, or thread_id::any()
+  /// @param info the info value to pass to the sender
+  ///
+  /// @return the exchange info or an error code
+  ///
+  template<class T, size_t T_Extent>
+  [[nodiscard]] auto receive(std::span<T, T_Extent> buffer,
+                             thread_id source = thread_id::any(),
+                             uint32_t info = 0) noexcept
+  {
+    return get(rx_bytes(buffer), source, info, K_FOREVER);
+  }
+
+  ///
+  /// @brief receive a message if one is waiting
+  ///
+  /// @param buffer the buffer to receive into
+  /// @param source the sending thread, or thread_id::any()
+  /// @param info the info value to pass to the sender
+  ///
+  /// @return the exchange info or an error code
+  ///
+  template<class T, size_t T_Extent>
+  [[nodiscard]] auto try_receive(std::span<T, T_Extent> buffer,
+                                 thread_id source = thread_id::any(),
+                                 uint32_t info = 0) noexcept
+  {
+    return get(rx_bytes(buffer), source, info, K_NO_WAIT);
+  }
+
+  ///
+  /// @brief receive a message waiting a certain amount of time
+  ///
+  /// @param buffer the buffer to receive into
+  /// @param timeout the time to wait
+  /// @param source the sending thread, or thread_id::any()
+  /// @param info the info value to pass to the sender
+  ///
+  /// @return the exchange info or an error code
+  ///
+  template<class T, size_t T_Extent, class T_Rep, class T_Period>
+  [[nodiscard]] auto
+  try_receive_for(std::span<T, T_Extent> buffer,
+                  const std::chrono::duration<T_Rep, T_Period>& timeout,
+                  thread_id source = thread_id::any(),
+                  uint32_t info = 0) noexcept
+  {
+    return get(rx_bytes(buffer), source, info,
+               to_timeout(timeout));
+  }
+
+  ///
+  /// @brief receive a message waiting until a certain time
+  ///
+  /// @param buffer the buffer to receive into
+  /// @param abs_time the time point to wait until
+  /// @param source the sending thread, or thread_id::any()
+  /// @param info the info value to pass to the sender
+  ///
+  /// @return the exchange info or an error code
+  ///
+  template<class T, size_t T_Extent, class T_Clock, class T_Duration>
+  [[nodiscard]] auto
+  try_receive_until(std::span<T, T_Extent> buffer,
+                    const std::chrono::time_point<T_Clock, T_Duration>& abs_time,
+                    thread_id source = thread_id::any(),
+                    uint32_t info = 0) noexcept
+  {
+    return get(rx_bytes(buffer), source, info,
+               to_timeout(abs_time));
+  }
+private:
+  template<class T, size_t T_Extent>
+  static auto tx_bytes(std::span<T, T_Extent> data) noexcept
+  {
+    static_assert(std::is_trivially_copyable_v<std::remove_cv_t<T>>);
+    return std::span<const std::byte>(std::as_bytes(data));
+  }
+
+  template<class T, size_t T_Extent>
+  static auto rx_bytes(std::span<T, T_Extent> buffer) noexcept
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+    return std::span<std::byte>(std::as_writable_bytes(buffer));
+  }
+
+  auto put(std::span<const std::byte> data, thread_id target,
+           uint32_t info, k_timeout_t timeout) noexcept
+  {
+    result<mbox_message_info, error_code> res;
+
+    struct k_mbox_msg msg{};
+    msg.info = info;
+    msg.size = data.size();
+    msg.tx_data = const_cast<std::byte*>(data.data());
+    msg.tx_target_thread = target.native_handle();
+
+    auto rc = k_mbox_put(native_handle(), &msg, timeout);
+    if (rc == 0) {
+      res.assign_value(mbox_message_info{
+        msg.size, msg.info, thread_id(msg.tx_target_thread) });
+    } else {
+      res.assign_error(to_error_code(-rc));
+    }
+
+    return res;
+  }
+
+  auto get(std::span<std::byte> buffer, thread_id source,
+           uint32_t info, k_timeout_t timeout) noexcept
+  {
+    result<mbox_message_info, error_code> res;
+
+    struct k_mbox_msg msg{};
+    msg.info = info;
+    msg.size = buffer.size();
+    msg.rx_source_thread = source.native_handle();
+
+    auto rc = k_mbox_get(native_handle(), &msg, buffer.data(), timeout);
+    if (rc == 0) {
+      res.assign_value(mbox_message_info{
+        msg.size, msg.info, thread_id(msg.rx_source_thread) });
+    } else {
+      res.assign_error(to_error_code(-rc));
+    }
+
+    return res;
+  }
+public:
+  mbox_base(const mbox_base&) = delete;
+  mbox_base(mbox_base&&) = delete;
+  mbox_base& operator=(const mbox_base&) = delete;
+  mbox_base& operator=(mbox_base&&) = delete;
+};
+
+///
+/// @brief mailbox that manages a k_mbox object
+///
+class mbox : public mbox_base<mbox> {
+public:
+  ///
+  /// @brief create new mailbox
+  ///
+  mbox() noexcept
+  {
+    k_mbox_init(&m_mbox);
+  }
+
+  ///
+  /// @brief get the Zephyr native mailbox handle
+  ///
+  /// @return pointer to a k_mbox
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return &m_mbox;
+  }
+
+  ///
+  /// @brief get the Zephyr native mailbox handle
+  ///
+  /// @return pointer to a k_mbox
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return &m_mbox;
+  }
+private:
+  native_type m_mbox;
+public:
+  mbox(const mbox&) = delete;
+  mbox(mbox&&) = delete;
+  mbox& operator=(const mbox&) = delete;
+  mbox& operator=(mbox&&) = delete;
+};
+
+///
+/// @brief mailbox that references a k_mbox object
+///
+class mbox_ref : public mbox_base<mbox_ref> {
+public:
+  ///
+  /// @brief wrap k_mbox
+  ///
+  /// @param m the k_mbox to reference
+  ///
+  /// @warning @a m must stay valid for the lifetime of this object
+  ///
+  constexpr explicit mbox_ref(native_pointer m) noexcept
+    : m_mbox_ptr(m)
+  {
+    __ASSERT_NO_MSG(m_mbox_ptr != nullptr);
+  }
+
+  ///
+  /// @brief Reference another mailbox object
+  ///
+  /// @param m the object to reference
+  ///
+  /// @warning @a m must stay valid for the lifetime of this object
+  ///
+  template<class T_Mbox>
+  constexpr explicit mbox_ref(T_Mbox& m) noexcept
+    : m_mbox_ptr(m.native_handle())
+  {
+    __ASSERT_NO_MSG(m_mbox_ptr != nullptr);
+  }
+
+  ///
+  /// @brief Reference another mailbox object
+  ///
+  /// @param m the object to reference
+  ///
+  /// @return *this
+  ///
+  /// @warning @a m must stay valid for the lifetime of this object
+  ///
+  constexpr mbox_ref& operator=(native_pointer m) noexcept
+  {
+    m_mbox_ptr = m;
+    __ASSERT_NO_MSG(m_mbox_ptr != nullptr);
+    return *this;
+  }
+
+  ///
+  /// @brief Reference another mailbox object
+  ///
+  /// @param m the object to reference
+  ///
+  /// @return *this
+  ///
+  /// @warning @a m must stay valid for the lifetime of this object
+  ///
+  template<class T_Mbox>
+  constexpr mbox_ref& operator=(T_Mbox& m) noexcept
+  {
+    m_mbox_ptr = m.native_handle();
+    __ASSERT_NO_MSG(m_mbox_ptr != nullptr);
+    return *this;
+  }
+
+  ///
+  /// @brief get the Zephyr native mailbox handle
+  ///
+  /// @return pointer to a k_mbox
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return m_mbox_ptr;
+  }
+
+  ///
+  /// @brief get the Zephyr native mailbox handle
+  ///
+  /// @return pointer to a k_mbox
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return m_mbox_ptr;
+  }
+private:
+  native_pointer m_mbox_ptr{ nullptr };
+public:
+  mbox_ref() = delete;
+};
+
+} // namespace zpp
+
+#endif // ZPP_INCLUDE_ZPP_MBOX_HPP
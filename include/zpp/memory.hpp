@@ -12,6 +12,9 @@
 
 #include <new>
 
+// the host C++ library needs its own allocator
+#ifndef CONFIG_ZPP_HOST_SHIM
+
 [[nodiscard]] void* operator new(std::size_t) noexcept
 {
   return nullptr;
@@ -52,4 +55,6 @@
   return nullptr;
 }
 
+#endif // CONFIG_ZPP_HOST_SHIM
+
 #endif // ZPP_INCLUDE_ZPP_MEMORY_HPP
@@ -0,0 +1,421 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_MSGQ_HPP
+#define ZPP_INCLUDE_ZPP_MSGQ_HPP
+
+#include <zpp/clock.hpp>
+#include <zpp/result.hpp>
+#include <zpp/error_code.hpp>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace zpp {
+
+///
+/// @brief Message queue CRTP base class
+///
+/// A k_msgq copies every message into its ring of fixed size slots, so
+/// unlike a fifo nothing has to stay alive after it was sent.
+///
+/// @param T_Msgq the CRTP derived type
+/// @param T_Item the message type, it must be trivially copyable
+///
+template<typename T_Msgq, typename T_Item>
+class msgq_base {
+public:
+  using native_type = struct k_msgq;
+  using native_pointer = native_type *;
+  using native_const_pointer = native_type const *;
+
+  using item_type = T_Item;
+
+  static_assert(std::is_trivially_copyable_v<item_type>,
+                "item must be trivially copyable");
+  static_assert(std::is_default_constructible_v<item_type>,
+                "item must be default constructible");
+protected:
+  ///
+  /// @brief default constructor, can only be called from derived types
+  ///
+  constexpr msgq_base() noexcept = default;
+public:
+  ///
+  /// @brief get the Zephyr native message queue handle
+  ///
+  /// @return pointer to a k_msgq
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return static_cast<T_Msgq*>(this)->native_handle();
+  }
+
+  ///
+  /// @brief get the Zephyr native message queue handle
+  ///
+  /// @return pointer to a k_msgq
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return static_cast<const T_Msgq*>(this)->native_handle();
+  }
+
+  ///
+  /// @brief send a message waiting for ever
+  ///
+  /// @param item the message to send
+  ///
+  /// @return an error code on failure
+  ///
+  [[nodiscard]] auto send(const item_type& item) noexcept
+  {
+    return send_native(item, K_FOREVER);
+  }
+
+  ///
+  /// @brief try to send a message without waiting
+  ///
+  /// @param item the message to send
+  ///
+  /// @return error_code::k_nomsg when the queue is full
+  ///
+  [[nodiscard]] auto try_send(const item_type& item) noexcept
+  {
+    return send_native(item, K_NO_WAIT);
+  }
+
+  ///
+  /// @brief try to send a message waiting a certain amount of time
+  ///
+  /// @param item the message to send
+  /// @param timeout The timeout before returning
+  ///
+  /// @return an error code on failure
+  ///
+  template<class T_Rep, class T_Period>
+  [[nodiscard]] auto
+  try_send_for(const item_type& item,
+               const std::chrono::duration<T_Rep, T_Period>& timeout) noexcept
+  {
+    return send_native(item, to_timeout(timeout));
+  }
+
+  ///
+  /// @brief try to send a message waiting until a certain time
+  ///
+  /// @param item the message to send
+  /// @param abs_time The time point to wait until
+  ///
+  /// @return an error code on failure
+  ///
+  template<class T_Clock, class T_Duration>
+  [[nodiscard]] auto
+  try_send_until(const item_type& item,
+                 const std::chrono::time_point<T_Clock, T_Duration>& abs_time) noexcept
+  {
+    return send_native(item, to_timeout(abs_time));
+  }
+
+  ///
+  /// @brief receive a message waiting for ever
+  ///
+  /// @return the message or an error code
+  ///
+  [[nodiscard]] auto receive() noexcept
+  {
+    return receive_native(K_FOREVER);
+  }
+
+  ///
+  /// @brief try to receive a message without waiting
+  ///
+  /// @return the message or error_code::k_nomsg when the queue is empty
+  ///
+  [[nodiscard]] auto try_receive() noexcept
+  {
+    return receive_native(K_NO_WAIT);
+  }
+
+  ///
+  /// @brief try to receive a message waiting a certain amount of time
+  ///
+  /// @param timeout The timeout before returning
+  ///
+  /// @return the message or an error code
+  ///
+  template<class T_Rep, class T_Period>
+  [[nodiscard]] auto
+  try_receive_for(const std::chrono::duration<T_Rep, T_Period>& timeout) noexcept
+  {
+    return receive_native(to_timeout(timeout));
+  }
+
+  ///
+  /// @brief try to receive a message waiting until a certain time
+  ///
+  /// @param abs_time The time point to wait until
+  ///
+  /// @return the message or an error code
+  ///
+  template<class T_Clock, class T_Duration>
+  [[nodiscard]] auto
+  try_receive_until(const std::chrono::time_point<T_Clock, T_Duration>& abs_time) noexcept
+  {
+    return receive_native(to_timeout(abs_time));
+  }
+
+  ///
+  /// @brief get the oldest message without removing it
+  ///
+  /// @return the message or error_code::k_nomsg when the queue is empty
+  ///
+  [[nodiscard]] auto peek() noexcept
+  {
+    result<item_type, error_code> res;
+
+    item_type item;
+    auto rc = k_msgq_peek(native_handle(), &item);
+    if (rc == 0) {
+      res.assign_value(item);
+    } else {
+      res.assign_error(to_error_code(-rc));
+    }
+
+    return res;
+  }
+
+  ///
+  /// @brief discard all messages
+  ///
+  void purge() noexcept
+  {
+    k_msgq_purge(native_handle());
+  }
+
+  ///
+  /// @brief get the number of messages in the queue
+  ///
+  /// @return the number of messages
+  ///
+  [[nodiscard]] size_t num_used() noexcept
+  {
+    return k_msgq_num_used_get(native_handle());
+  }
+
+  ///
+  /// @brief get the number of messages that can be sent without waiting
+  ///
+  /// @return the number of free slots
+  ///
+  [[nodiscard]] size_t num_free() noexcept
+  {
+    return k_msgq_num_free_get(native_handle());
+  }
+private:
+  auto send_native(const item_type& item, k_timeout_t timeout) noexcept
+  {
+    __ASSERT_NO_MSG(native_handle()->msg_size == sizeof(item_type));
+
+    result<void, error_code> res;
+
+    auto rc = k_msgq_put(native_handle(), &item, timeout);
+    if (rc == 0) {
+      res.assign_value();
+    } else {
+      res.assign_error(to_error_code(-rc));
+    }
+
+    return res;
+  }
+
+  auto receive_native(k_timeout_t timeout) noexcept
+  {
+    __ASSERT_NO_MSG(native_handle()->msg_size == sizeof(item_type));
+
+    result<item_type, error_code> res;
+
+    item_type item;
+    auto rc = k_msgq_get(native_handle(), &item, timeout);
+    if (rc == 0) {
+      res.assign_value(item);
+    } else {
+      res.assign_error(to_error_code(-rc));
+    }
+
+    return res;
+  }
+public:
+  msgq_base(const msgq_base&) = delete;
+  msgq_base(msgq_base&&) = delete;
+  msgq_base& operator=(const msgq_base&) = delete;
+  msgq_base& operator=(msgq_base&&) = delete;
+};
+
+///
+/// @brief message queue that manages a k_msgq object and its storage
+///
+/// @param T_Item the message type, it must be trivially copyable
+/// @param T_Size the maximum number of messages in the queue
+///
+template<typename T_Item, size_t T_Size>
+class msgq : public msgq_base<msgq<T_Item, T_Size>, T_Item> {
+public:
+  using typename msgq_base<msgq<T_Item, T_Size>, T_Item>::native_type;
+  using typename msgq_base<msgq<T_Item, T_Size>, T_Item>::native_pointer;
+  using typename msgq_base<msgq<T_Item, T_Size>, T_Item>::native_const_pointer;
+
+  static_assert(T_Size > 0);
+
+  ///
+  /// @brief the maximum number of messages in the queue
+  ///
+  static constexpr size_t max_size = T_Size;
+public:
+  ///
+  /// @brief create new message queue
+  ///
+  msgq() noexcept
+  {
+    k_msgq_init(&m_msgq, m_data, sizeof(T_Item), T_Size);
+  }
+
+  ///
+  /// @brief get the Zephyr native message queue handle
+  ///
+  /// @return pointer to a k_msgq
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return &m_msgq;
+  }
+
+  ///
+  /// @brief get the Zephyr native message queue handle
+  ///
+  /// @return pointer to a k_msgq
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return &m_msgq;
+  }
+private:
+  native_type                       m_msgq;
+  alignas(T_Item) char              m_data[T_Size * sizeof(T_Item)];
+public:
+  msgq(const msgq&) = delete;
+  msgq(msgq&&) = delete;
+  msgq& operator=(const msgq&) = delete;
+  msgq& operator=(msgq&&) = delete;
+};
+
+///
+/// @brief message queue that references a k_msgq object
+///
+/// @param T_Item the message type, it must match the message size of
+///        the k_msgq
+///
+template<typename T_Item>
+class msgq_ref : public msgq_base<msgq_ref<T_Item>, T_Item> {
+public:
+  using typename msgq_base<msgq_ref<T_Item>, T_Item>::native_type;
+  using typename msgq_base<msgq_ref<T_Item>, T_Item>::native_pointer;
+  using typename msgq_base<msgq_ref<T_Item>, T_Item>::native_const_pointer;
+public:
+  ///
+  /// @brief wrap k_msgq
+  ///
+  /// @param q the k_msgq to reference
+  ///
+  /// @warning @a q must stay valid for the lifetime of this object
+  ///
+  constexpr explicit msgq_ref(native_pointer q) noexcept
+    : m_msgq_ptr(q)
+  {
+    __ASSERT_NO_MSG(m_msgq_ptr != nullptr);
+  }
+
+  ///
+  /// @brief Reference another message queue object
+  ///
+  /// @param q the object to reference
+  ///
+  /// @warning @a q must stay valid for the lifetime of this object
+  ///
+  template<size_t T_Size>
+  constexpr explicit msgq_ref(msgq<T_Item, T_Size>& q) noexcept
+    : m_msgq_ptr(q.native_handle())
+  {
+    __ASSERT_NO_MSG(m_msgq_ptr != nullptr);
+  }
+
+  ///
+  /// @brief Reference another message queue object
+  ///
+  /// @param q the object to reference
+  ///
+  /// @return *this
+  ///
+  /// @warning @a q must stay valid for the lifetime of this object
+  ///
+  constexpr msgq_ref& operator=(native_pointer q) noexcept
+  {
+    m_msgq_ptr = q;
+    __ASSERT_NO_MSG(m_msgq_ptr != nullptr);
+    return *this;
+  }
+
+  ///
+  /// @brief Reference another message queue object
+  ///
+  /// @param q the object to reference
+  ///
+  /// @return *this
+  ///
+  /// @warning @a q must stay valid for the lifetime of this object
+  ///
+  template<size_t T_Size>
+  constexpr msgq_ref& operator=(msgq<T_Item, T_Size>& q) noexcept
+  {
+    m_msgq_ptr = q.native_handle();
+    __ASSERT_NO_MSG(m_msgq_ptr != nullptr);
+    return *this;
+  }
+
+  ///
+  /// @brief get the Zephyr native message queue handle
+  ///
+  /// @return pointer to a k_msgq
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return m_msgq_ptr;
+  }
+
+  ///
+  /// @brief get the Zephyr native message queue handle
+  ///
+  /// @return pointer to a k_msgq
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return m_msgq_ptr;
+  }
+private:
+  native_pointer m_msgq_ptr{ nullptr };
+public:
+  msgq_ref() = delete;
+};
+
+} // namespace zpp
+
+#endif // ZPP_INCLUDE_ZPP_MSGQ_HPP
@@ -12,26 +12,33 @@
 
 #include <chrono>
 
+#include <zpp/clock.hpp>
 #include <zpp/result.hpp>
 #include <zpp/error_code.hpp>
+#include <zpp/lock_stats.hpp>
 
 namespace zpp {
 
 ///
 /// @brief A recursive mutex CRTP base class.
 ///
-template<typename T_Mutex>
+/// @param T_Mutex the derived mutex class
+/// @param T_LockStats the statistics policy, no_lock_stats or lock_stats
+///
+template<typename T_Mutex, typename T_LockStats = no_lock_stats>
 class mutex_base
 {
 public:
   using native_type = struct k_mutex;
   using native_pointer = native_type*;
   using native_const_pointer = native_type const *;
+  using lock_stats_type = T_LockStats;
 protected:
   ///
   /// @brief Protected default constructor so only derived objects can be created
   ///
   constexpr mutex_base() noexcept
+    : m_stats(lock_kind::mutex, this)
   {
   }
 
@@ -45,7 +52,7 @@ public:
   {
     result<void, error_code> res;
 
-    auto rc = k_mutex_lock(native_handle(), K_FOREVER);
+    auto rc = lock_native(K_FOREVER);
     if (rc == 0) {
       res.assign_value();
     } else {
@@ -64,7 +71,7 @@ public:
   {
     result<void, error_code> res;
 
-    auto rc = k_mutex_lock(native_handle(), K_NO_WAIT);
+    auto rc = lock_native(K_NO_WAIT);
     if (rc == 0) {
       res.assign_value();
     } else {
@@ -89,7 +96,30 @@ public:
 
     result<void, error_code> res;
 
-    auto rc = k_mutex_lock(native_handle(), to_timeout(timeout));
+    auto rc = lock_native(to_timeout(timeout));
+    if (rc == 0) {
+      res.assign_value();
+    } else {
+      res.assign_error(to_error_code(-rc));
+    }
+
+    return res;
+  }
+
+  ///
+  /// @brief Try locking the mutex until a certain time.
+  ///
+  /// @param abs_time The time point to wait until before returning
+  ///
+  /// @return true if successfully locked.
+  ///
+  template<class T_Clock, class T_Duration>
+  [[nodiscard]] auto
+  try_lock_until(const std::chrono::time_point<T_Clock, T_Duration>& abs_time) noexcept
+  {
+    result<void, error_code> res;
+
+    auto rc = lock_native(to_timeout(abs_time));
     if (rc == 0) {
       res.assign_value();
     } else {
@@ -108,6 +138,10 @@ public:
   {
     result<void, error_code> res;
 
+    if constexpr (T_LockStats::enabled) {
+      m_stats.unlocking();
+    }
+
     auto rc = k_mutex_unlock(native_handle());
     if (rc == 0) {
       res.assign_value();
@@ -137,6 +171,40 @@ public:
   {
     return static_cast<const T_Mutex*>(this)->native_handle();
   }
+
+  ///
+  /// @brief get the lock statistics of this mutex
+  ///
+  /// @return the statistics policy object
+  ///
+  constexpr auto stats() noexcept -> lock_stats_type&
+  {
+    return m_stats;
+  }
+private:
+  int lock_native(k_timeout_t timeout) noexcept
+  {
+    if constexpr (T_LockStats::enabled) {
+      auto start = T_LockStats::now();
+      bool contended = false;
+
+      auto rc = k_mutex_lock(native_handle(), K_NO_WAIT);
+      if (rc != 0 && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+        contended = true;
+        rc = k_mutex_lock(native_handle(), timeout);
+      }
+
+      if (rc == 0) {
+        m_stats.locked(start, contended);
+      }
+
+      return rc;
+    } else {
+      return k_mutex_lock(native_handle(), timeout);
+    }
+  }
+private:
+  [[no_unique_address]] T_LockStats m_stats;
 public:
   mutex_base(const mutex_base&) = delete;
   mutex_base(mutex_base&&) = delete;
@@ -147,7 +215,7 @@ public:
 ///
 /// @brief A recursive mutex class.
 ///
-class mutex : public mutex_base<mutex> {
+class mutex : public mutex_base<mutex, default_lock_stats> {
 public:
   ///
   /// @brief Default contructor
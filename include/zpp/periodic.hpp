@@ -0,0 +1,152 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_PERIODIC_HPP
+#define ZPP_INCLUDE_ZPP_PERIODIC_HPP
+
+#include <zpp/clock.hpp>
+#include <zpp/thread.hpp>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace zpp {
+
+///
+/// @brief Helper to run the current thread with a fixed period
+///
+/// Release times are computed as start + n * period on the uptime_clock,
+/// so the period does not drift when the work takes a variable amount
+/// of time. When a release is missed completely it is skipped and
+/// counted as an overrun, so the phase of the releases stays the same.
+///
+/// With CONFIG_SCHED_DEADLINE the thread deadline is set to the release
+/// time plus the relative deadline each period, so among threads with
+/// the same priority the one closest to its deadline runs first.
+///
+class periodic {
+public:
+  using clock = uptime_clock;
+  using duration = clock::duration;
+  using time_point = clock::time_point;
+public:
+  ///
+  /// @brief Create a periodic helper with the deadline equal to the period
+  ///
+  /// The first release is one period from now.
+  ///
+  /// @param period The period
+  ///
+  template<class T_Rep, class T_Period>
+  explicit periodic(const std::chrono::duration<T_Rep, T_Period>& period) noexcept
+    : periodic(period, period)
+  {
+  }
+
+  ///
+  /// @brief Create a periodic helper
+  ///
+  /// The first release is one period from now.
+  ///
+  /// @param period The period
+  /// @param deadline The deadline relative to each release
+  ///
+  template<class T_Rep1, class T_Period1, class T_Rep2, class T_Period2>
+  periodic(const std::chrono::duration<T_Rep1, T_Period1>& period,
+           const std::chrono::duration<T_Rep2, T_Period2>& deadline) noexcept
+    : m_period(std::chrono::duration_cast<duration>(period))
+    , m_deadline(std::chrono::duration_cast<duration>(deadline))
+    , m_next(clock::now() + m_period)
+  {
+    __ASSERT_NO_MSG(m_period > duration::zero());
+    __ASSERT_NO_MSG(m_deadline > duration::zero());
+  }
+
+  ///
+  /// @brief Sleep until the next release time
+  ///
+  /// @return The number of releases that were missed, 0 when on time
+  ///
+  uint32_t wait() noexcept
+  {
+    uint32_t missed = 0;
+
+    auto now = clock::now();
+    if (now - m_next >= m_period) {
+      missed = static_cast<uint32_t>((now - m_next) / m_period);
+      m_next += m_period * missed;
+      m_overruns += missed;
+    }
+
+    this_thread::sleep_until(m_next);
+
+#ifdef CONFIG_SCHED_DEADLINE
+    auto remaining = (m_next + m_deadline) - clock::now();
+    this_thread::set_deadline(remaining);
+#endif
+
+    m_next += m_period;
+
+    return missed;
+  }
+
+  ///
+  /// @brief Restart the releases, the next one is one period from now
+  ///
+  void reset() noexcept
+  {
+    m_next = clock::now() + m_period;
+    m_overruns = 0;
+  }
+
+  ///
+  /// @brief Get the period
+  ///
+  /// @return The period
+  ///
+  duration period() const noexcept
+  {
+    return m_period;
+  }
+
+  ///
+  /// @brief Get the next release time
+  ///
+  /// @return The time the next wait() returns
+  ///
+  time_point next_release() const noexcept
+  {
+    return m_next;
+  }
+
+  ///
+  /// @brief Get the total number of missed releases
+  ///
+  /// @return The number of missed releases since creation or reset()
+  ///
+  uint32_t overruns() const noexcept
+  {
+    return m_overruns;
+  }
+private:
+  duration   m_period;
+  duration   m_deadline;
+  time_point m_next;
+  uint32_t   m_overruns{ 0 };
+public:
+  periodic() = delete;
+  periodic(const periodic&) = delete;
+  periodic(periodic&&) = delete;
+  periodic& operator=(const periodic&) = delete;
+  periodic& operator=(periodic&&) = delete;
+};
+
+} // namespace zpp
+
+#endif // ZPP_INCLUDE_ZPP_PERIODIC_HPP
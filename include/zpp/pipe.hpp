@@ -0,0 +1,534 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_PIPE_HPP
+#define ZPP_INCLUDE_ZPP_PIPE_HPP
+
+#include <zpp/clock.hpp>
+#include <zpp/result.hpp>
+#include <zpp/error_code.hpp>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <span>
+
+#ifdef CONFIG_PIPES
+
+namespace zpp {
+
+///
+/// @brief Byte stream pipe CRTP base class
+///
+/// A pipe copies the data straight into its ring buffer, or directly into
+/// the buffer of a waiting reader, so unlike a fifo no item has to be
+/// allocated for every chunk that is sent.
+///
+/// The transfer functions without a @a min_bytes argument transfer the
+/// whole span, the ones with it transfer at least @a min_bytes and as
+/// much more as possible, 0 means there is no minimum.
+///
+/// All transfer functions return the number of bytes transferred. When a
+/// wait timed out after part of the data was transferred the partial
+/// count is returned as success, even when it is less than the minimum,
+/// so a caller that needs the minimum must check the count. An error is
+/// only returned when no data was transferred at all.
+///
+/// @param T_Pipe the CRTP derived type
+///
+template<typename T_Pipe>
+class pipe_base {
+public:
+  using native_type = struct k_pipe;
+  using native_pointer = native_type *;
+  using native_const_pointer = native_type const *;
+protected:
+  ///
+  /// @brief default constructor, can only be called from derived types
+  ///
+  constexpr pipe_base() noexcept = default;
+public:
+  ///
+  /// @brief get the Zephyr native pipe handle
+  ///
+  /// @return pointer to a k_pipe
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return static_cast<T_Pipe*>(this)->native_handle();
+  }
+
+  ///
+  /// @brief get the Zephyr native pipe handle
+  ///
+  /// @return pointer to a k_pipe
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return static_cast<const T_Pipe*>(this)->native_handle();
+  }
+
+  ///
+  /// @brief write all data to the pipe waiting forever
+  ///
+  /// @param data the data to write
+  ///
+  /// @return the number of bytes written or an error code
+  ///
+  [[nodiscard]] auto write(std::span<const std::byte> data) noexcept
+  {
+    return put(data, data.size(), K_FOREVER);
+  }
+
+  ///
+  /// @brief write all data to the pipe without waiting
+  ///
+  /// @param data the data to write
+  ///
+  /// @return the number of bytes written or an error code
+  ///
+  [[nodiscard]] auto try_write(std::span<const std::byte> data) noexcept
+  {
+    return put(data, data.size(), K_NO_WAIT);
+  }
+
+  ///
+  /// @brief write data to the pipe without waiting
+  ///
+  /// @param data the data to write
+  /// @param min_bytes the minimum number of bytes that must be written
+  ///
+  /// @return the number of bytes written or an error code
+  ///
+  [[nodiscard]] auto
+  try_write(std::span<const std::byte> data, size_t min_bytes) noexcept
+  {
+    return put(data, min_bytes, K_NO_WAIT);
+  }
+
+  ///
+  /// @brief write data to the pipe waiting a certain amount of time
+  ///
+  /// @param data the data to write
+  /// @param timeout the time to wait for @a min_bytes to be written
+  /// @param min_bytes the minimum number of bytes that must be written
+  ///
+  /// @return the number of bytes written or an error code
+  ///
+  template<class T_Rep, class T_Period>
+  [[nodiscard]] auto
+  try_write_for(std::span<const std::byte> data,
+                const std::chrono::duration<T_Rep, T_Period>& timeout,
+                size_t min_bytes) noexcept
+  {
+    return put(data, min_bytes, to_timeout(timeout));
+  }
+
+  ///
+  /// @brief write all data to the pipe waiting a certain amount of time
+  ///
+  /// @param data the data to write
+  /// @param timeout the time to wait for the data to be written
+  ///
+  /// @return the number of bytes written or an error code
+  ///
+  template<class T_Rep, class T_Period>
+  [[nodiscard]] auto
+  try_write_for(std::span<const std::byte> data,
+                const std::chrono::duration<T_Rep, T_Period>& timeout) noexcept
+  {
+    return put(data, data.size(), to_timeout(timeout));
+  }
+
+  ///
+  /// @brief write data to the pipe waiting until a certain time
+  ///
+  /// @param data the data to write
+  /// @param abs_time the time point to wait until
+  /// @param min_bytes the minimum number of bytes that must be written
+  ///
+  /// @return the number of bytes written or an error code
+  ///
+  template<class T_Clock, class T_Duration>
+  [[nodiscard]] auto
+  try_write_until(std::span<const std::byte> data,
+                  const std::chrono::time_point<T_Clock, T_Duration>& abs_time,
+                  size_t min_bytes) noexcept
+  {
+    return put(data, min_bytes, to_timeout(abs_time));
+  }
+
+  ///
+  /// @brief write all data to the pipe waiting until a certain time
+  ///
+  /// @param data the data to write
+  /// @param abs_time the time point to wait until
+  ///
+  /// @return the number of bytes written or an error code
+  ///
+  template<class T_Clock, class T_Duration>
+  [[nodiscard]] auto
+  try_write_until(std::span<const std::byte> data,
+                  const std::chrono::time_point<T_Clock, T_Duration>& abs_time) noexcept
+  {
+    return put(data, data.size(), to_timeout(abs_time));
+  }
+
+  ///
+  /// @brief fill the whole buffer from the pipe waiting forever
+  ///
+  /// @param buffer the buffer to read into
+  ///
+  /// @return the number of bytes read or an error code
+  ///
+  [[nodiscard]] auto read(std::span<std::byte> buffer) noexcept
+  {
+    return get(buffer, buffer.size(), K_FOREVER);
+  }
+
+  ///
+  /// @brief read data from the pipe waiting forever
+  ///
+  /// @param buffer the buffer to read into
+  /// @param min_bytes the minimum number of bytes to read
+  ///
+  /// @return the number of bytes read or an error code
+  ///
+  [[nodiscard]] auto
+  read(std::span<std::byte> buffer, size_t min_bytes) noexcept
+  {
+    return get(buffer, min_bytes, K_FOREVER);
+  }
+
+  ///
+  /// @brief fill the whole buffer from the pipe without waiting
+  ///
+  /// @param buffer the buffer to read into
+  ///
+  /// @return the number of bytes read or an error code
+  ///
+  [[nodiscard]] auto try_read(std::span<std::byte> buffer) noexcept
+  {
+    return get(buffer, buffer.size(), K_NO_WAIT);
+  }
+
+  ///
+  /// @brief read the available data from the pipe without waiting
+  ///
+  /// @param buffer the buffer to read into
+  /// @param min_bytes the minimum number of bytes that must be read
+  ///
+  /// @return the number of bytes read or an error code
+  ///
+  [[nodiscard]] auto
+  try_read(std::span<std::byte> buffer, size_t min_bytes) noexcept
+  {
+    return get(buffer, min_bytes, K_NO_WAIT);
+  }
+
+  ///
+  /// @brief read data from the pipe waiting a certain amount of time
+  ///
+  /// @param buffer the buffer to read into
+  /// @param timeout the time to wait for @a min_bytes to be read
+  /// @param min_bytes the minimum number of bytes to read
+  ///
+  /// @return the number of bytes read or an error code
+  ///
+  template<class T_Rep, class T_Period>
+  [[nodiscard]] auto
+  try_read_for(std::span<std::byte> buffer,
+               const std::chrono::duration<T_Rep, T_Period>& timeout,
+               size_t min_bytes) noexcept
+  {
+    return get(buffer, min_bytes, to_timeout(timeout));
+  }
+
+  ///
+  /// @brief fill the whole buffer from the pipe waiting a certain amount
+  ///        of time
+  ///
+  /// @param buffer the buffer to read into
+  /// @param timeout the time to wait for the buffer to be filled
+  ///
+  /// @return the number of bytes read or an error code
+  ///
+  template<class T_Rep, class T_Period>
+  [[nodiscard]] auto
+  try_read_for(std::span<std::byte> buffer,
+               const std::chrono::duration<T_Rep, T_Period>& timeout) noexcept
+  {
+    return get(buffer, buffer.size(), to_timeout(timeout));
+  }
+
+  ///
+  /// @brief read data from the pipe waiting until a certain time
+  ///
+  /// @param buffer the buffer to read into
+  /// @param abs_time the time point to wait until
+  /// @param min_bytes the minimum number of bytes to read
+  ///
+  /// @return the number of bytes read or an error code
+  ///
+  template<class T_Clock, class T_Duration>
+  [[nodiscard]] auto
+  try_read_until(std::span<std::byte> buffer,
+                 const std::chrono::time_point<T_Clock, T_Duration>& abs_time,
+                 size_t min_bytes) noexcept
+  {
+    return get(buffer, min_bytes, to_timeout(abs_time));
+  }
+
+  ///
+  /// @brief fill the whole buffer from the pipe waiting until a certain
+  ///        time
+  ///
+  /// @param buffer the buffer to read into
+  /// @param abs_time the time point to wait until
+  ///
+  /// @return the number of bytes read or an error code
+  ///
+  template<class T_Clock, class T_Duration>
+  [[nodiscard]] auto
+  try_read_until(std::span<std::byte> buffer,
+                 const std::chrono::time_point<T_Clock, T_Duration>& abs_time) noexcept
+  {
+    return get(buffer, buffer.size(), to_timeout(abs_time));
+  }
+
+  ///
+  /// @brief get the number of bytes that can be read without waiting
+  ///
+  /// @return the number of bytes in the pipe buffer
+  ///
+  [[nodiscard]] size_t read_avail() noexcept
+  {
+    return k_pipe_read_avail(native_handle());
+  }
+
+  ///
+  /// @brief get the number of bytes that can be written without waiting
+  ///
+  /// @return the free space in the pipe buffer
+  ///
+  [[nodiscard]] size_t write_avail() noexcept
+  {
+    return k_pipe_write_avail(native_handle());
+  }
+
+  ///
+  /// @brief discard the buffered data and the data of waiting writers
+  ///
+  void flush() noexcept
+  {
+    k_pipe_flush(native_handle());
+  }
+
+  ///
+  /// @brief discard only the data in the pipe buffer
+  ///
+  void buffer_flush() noexcept
+  {
+    k_pipe_buffer_flush(native_handle());
+  }
+private:
+  auto put(std::span<const std::byte> data, size_t min_bytes,
+           k_timeout_t timeout) noexcept
+  {
+    __ASSERT_NO_MSG(min_bytes <= data.size());
+
+    result<size_t, error_code> res;
+
+    size_t written{ 0 };
+    auto rc = k_pipe_put(native_handle(), data.data(), data.size(),
+                         &written, min_bytes, timeout);
+    if (rc == 0 || written > 0) {
+      res.assign_value(written);
+    } else {
+      res.assign_error(to_error_code(-rc));
+    }
+
+    return res;
+  }
+
+  auto get(std::span<std::byte> buffer, size_t min_bytes,
+           k_timeout_t timeout) noexcept
+  {
+    __ASSERT_NO_MSG(min_bytes <= buffer.size());
+
+    result<size_t, error_code> res;
+
+    size_t read{ 0 };
+    auto rc = k_pipe_get(native_handle(), buffer.data(), buffer.size(),
+                         &read, min_bytes, timeout);
+    if (rc == 0 || read > 0) {
+      res.assign_value(read);
+    } else {
+      res.assign_error(to_error_code(-rc));
+    }
+
+    return res;
+  }
+public:
+  pipe_base(const pipe_base&) = delete;
+  pipe_base(pipe_base&&) = delete;
+  pipe_base& operator=(const pipe_base&) = delete;
+  pipe_base& operator=(pipe_base&&) = delete;
+};
+
+///
+/// @brief pipe that manages a k_pipe object and its buffer
+///
+/// @param T_Size the size of the pipe buffer in bytes, with 0 data is
+///        only transferred directly between a writer and a waiting reader
+///
+template<size_t T_Size>
+class pipe : public pipe_base<pipe<T_Size>> {
+public:
+  using typename pipe_base<pipe<T_Size>>::native_type;
+  using typename pipe_base<pipe<T_Size>>::native_pointer;
+  using typename pipe_base<pipe<T_Size>>::native_const_pointer;
+
+  ///
+  /// @brief the size of the pipe buffer
+  ///
+  static constexpr size_t buffer_size = T_Size;
+public:
+  ///
+  /// @brief create new pipe
+  ///
+  pipe() noexcept
+  {
+    k_pipe_init(&m_pipe, T_Size > 0 ? m_buffer.data() : nullptr, T_Size);
+  }
+
+  ///
+  /// @brief get the Zephyr native pipe handle
+  ///
+  /// @return pointer to a k_pipe
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return &m_pipe;
+  }
+
+  ///
+  /// @brief get the Zephyr native pipe handle
+  ///
+  /// @return pointer to a k_pipe
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return &m_pipe;
+  }
+private:
+  native_type                        m_pipe;
+  std::array<unsigned char, T_Size>  m_buffer;
+public:
+  pipe(const pipe&) = delete;
+  pipe(pipe&&) = delete;
+  pipe& operator=(const pipe&) = delete;
+  pipe& operator=(pipe&&) = delete;
+};
+
+///
+/// @brief pipe that references a k_pipe object
+///
+class pipe_ref : public pipe_base<pipe_ref> {
+public:
+  ///
+  /// @brief wrap k_pipe
+  ///
+  /// @param p the k_pipe to reference
+  ///
+  /// @warning @a p must stay valid for the lifetime of this object
+  ///
+  constexpr explicit pipe_ref(native_pointer p) noexcept
+    : m_pipe_ptr(p)
+  {
+    __ASSERT_NO_MSG(m_pipe_ptr != nullptr);
+  }
+
+  ///
+  /// @brief Reference another pipe object
+  ///
+  /// @param p the object to reference
+  ///
+  /// @warning @a p must stay valid for the lifetime of this object
+  ///
+  template<class T_Pipe>
+  constexpr explicit pipe_ref(T_Pipe& p) noexcept
+    : m_pipe_ptr(p.native_handle())
+  {
+    __ASSERT_NO_MSG(m_pipe_ptr != nullptr);
+  }
+
+  ///
+  /// @brief Reference another pipe object
+  ///
+  /// @param p the object to reference
+  ///
+  /// @return *this
+  ///
+  /// @warning @a p must stay valid for the lifetime of this object
+  ///
+  constexpr pipe_ref& operator=(native_pointer p) noexcept
+  {
+    m_pipe_ptr = p;
+    __ASSERT_NO_MSG(m_pipe_ptr != nullptr);
+    return *this;
+  }
+
+  ///
+  /// @brief Reference another pipe object
+  ///
+  /// @param p the object to reference
+  ///
+  /// @return *this
+  ///
+  /// @warning @a p must stay valid for the lifetime of this object
+  ///
+  template<class T_Pipe>
+  constexpr pipe_ref& operator=(T_Pipe& p) noexcept
+  {
+    m_pipe_ptr = p.native_handle();
+    __ASSERT_NO_MSG(m_pipe_ptr != nullptr);
+    return *this;
+  }
+
+  ///
+  /// @brief get the Zephyr native pipe handle
+  ///
+  /// @return pointer to a k_pipe
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return m_pipe_ptr;
+  }
+
+  ///
+  /// @brief get the Zephyr native pipe handle
+  ///
+  /// @return pointer to a k_pipe
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return m_pipe_ptr;
+  }
+private:
+  native_pointer m_pipe_ptr{ nullptr };
+public:
+  pipe_ref() = delete;
+};
+
+} // namespace zpp
+
+#endif // CONFIG_PIPES
+
+#endif // ZPP_INCLUDE_ZPP_PIPE_HPP
@@ -20,6 +20,8 @@
 #include <zpp/sem.hpp>
 #include <zpp/fifo.hpp>
 #include <zpp/poll_signal.hpp>
+#include <zpp/pipe.hpp>
+#include <zpp/msgq.hpp>
 
 namespace zpp {
 
@@ -37,6 +39,8 @@ public:
     type_fifo,
     type_signal,
     type_ignore,
+    type_pipe,
+    type_msgq,
   };
 
   ///
@@ -156,6 +160,74 @@ public:
     m_event->tag = (int)type_tag::type_signal;
   }
 
+#if defined(CONFIG_PIPES) && defined(K_POLL_TYPE_PIPE_DATA_AVAILABLE)
+  ///
+  /// @brief assign a pipe to this event, ready when there is data to read
+  ///
+  /// @param p the pipe to poll
+  ///
+  template<size_t T_Size>
+  void assign(zpp::pipe<T_Size>& p) noexcept
+  {
+    __ASSERT_NO_MSG(m_event != nullptr);
+    k_poll_event_init(m_event,
+      K_POLL_TYPE_PIPE_DATA_AVAILABLE,
+      K_POLL_MODE_NOTIFY_ONLY,
+      p.native_handle());
+    m_event->tag = (int)type_tag::type_pipe;
+  }
+
+  ///
+  /// @brief assign a pipe to this event, ready when there is data to read
+  ///
+  /// @param p the pipe to poll
+  ///
+  void assign(pipe_ref& p) noexcept
+  {
+    __ASSERT_NO_MSG(m_event != nullptr);
+    k_poll_event_init(m_event,
+      K_POLL_TYPE_PIPE_DATA_AVAILABLE,
+      K_POLL_MODE_NOTIFY_ONLY,
+      p.native_handle());
+    m_event->tag = (int)type_tag::type_pipe;
+  }
+#endif
+
+#ifdef K_POLL_TYPE_MSGQ_DATA_AVAILABLE
+  ///
+  /// @brief assign a message queue to this event, ready when there is a
+  ///        message to receive
+  ///
+  /// @param q the message queue to poll
+  ///
+  template<typename T_Item, size_t T_Size>
+  void assign(zpp::msgq<T_Item, T_Size>& q) noexcept
+  {
+    __ASSERT_NO_MSG(m_event != nullptr);
+    k_poll_event_init(m_event,
+      K_POLL_TYPE_MSGQ_DATA_AVAILABLE,
+      K_POLL_MODE_NOTIFY_ONLY,
+      q.native_handle());
+    m_event->tag = (int)type_tag::type_msgq;
+  }
+
+  ///
+  /// @brief assign a message queue to this event, ready when there is a
+  ///        message to receive
+  ///
+  /// @param q the message queue to poll
+  ///
+  template<typename T_Item>
+  void assign(msgq_ref<T_Item>& q) noexcept
+  {
+    __ASSERT_NO_MSG(m_event != nullptr);
+    k_poll_event_init(m_event,
+      K_POLL_TYPE_MSGQ_DATA_AVAILABLE,
+      K_POLL_MODE_NOTIFY_ONLY,
+      q.native_handle());
+    m_event->tag = (int)type_tag::type_msgq;
+  }
+#endif
 
   ///
   /// @brief check if this event is ready
@@ -178,6 +250,18 @@ public:
       return (m_event->state & K_POLL_STATE_SIGNALED);
     case type_tag::type_ignore:
       return false;
+    case type_tag::type_pipe:
+#if defined(CONFIG_PIPES) && defined(K_POLL_STATE_PIPE_DATA_AVAILABLE)
+      return (m_event->state & K_POLL_STATE_PIPE_DATA_AVAILABLE);
+#else
+      return false;
+#endif
+    case type_tag::type_msgq:
+#ifdef K_POLL_STATE_MSGQ_DATA_AVAILABLE
+      return (m_event->state & K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+#else
+      return false;
+#endif
     }
 
     return false;
@@ -259,6 +343,44 @@ public:
 
     return poll_signal_ref(m_event->signal);
   }
+
+#if defined(CONFIG_PIPES) && defined(K_POLL_TYPE_PIPE_DATA_AVAILABLE)
+  ///
+  /// @brief get access to the pipe of the event
+  ///
+  /// @warning the event must be a pipe event
+  ///
+  /// @return a pipe_ref that points to the registered pipe
+  ///
+  auto pipe() noexcept
+  {
+    __ASSERT_NO_MSG(m_event != nullptr);
+    __ASSERT_NO_MSG(m_event->tag == (int)type_tag::type_pipe);
+    __ASSERT_NO_MSG(m_event->pipe != nullptr);
+
+    return pipe_ref(m_event->pipe);
+  }
+#endif
+
+#ifdef K_POLL_TYPE_MSGQ_DATA_AVAILABLE
+  ///
+  /// @brief get access to the message queue of the event
+  ///
+  /// @warning the event must be a message queue event and the message
+  ///          type must match the registered message queue
+  ///
+  /// @return a msgq_ref that points to the registered message queue
+  ///
+  template<typename T_Item>
+  auto msgq() noexcept
+  {
+    __ASSERT_NO_MSG(m_event != nullptr);
+    __ASSERT_NO_MSG(m_event->tag == (int)type_tag::type_msgq);
+    __ASSERT_NO_MSG(m_event->msgq != nullptr);
+
+    return msgq_ref<T_Item>(m_event->msgq);
+  }
+#endif
 private:
   k_poll_event* m_event{ nullptr };
 public:
@@ -12,10 +12,28 @@
 
 #include <zpp/error_code.hpp>
 
+#include <functional>
+#include <type_traits>
 #include <utility>
 
 namespace zpp {
 
+template<typename T_Ok, typename T_Error>
+class result;
+
+namespace internal {
+
+template<typename T>
+struct is_result : std::false_type {};
+
+template<typename T_Ok, typename T_Error>
+struct is_result<result<T_Ok, T_Error>> : std::true_type {};
+
+template<typename T>
+inline constexpr bool is_result_v = is_result<std::remove_cvref_t<T>>::value;
+
+} // namespace internal
+
 ////////////////////////////////////////////////////////////////////////////////
 ///
 /// @brief helper class for error result
@@ -24,9 +42,7 @@ namespace zpp {
 template<typename T_Error>
 class error_result {
   static_assert(!std::is_void_v<T_Error>);
-  static_assert(std::is_copy_constructible_v<T_Error>);
   static_assert(std::is_move_constructible_v<T_Error>);
-  static_assert(std::is_copy_assignable_v<T_Error>);
   static_assert(std::is_move_assignable_v<T_Error>);
 public:
   error_result() noexcept = delete;
@@ -88,17 +104,41 @@ private:
 template<typename T_Ok, typename T_Error>
 class result {
   static_assert(!std::is_void_v<T_Ok>);
-  static_assert(std::is_copy_constructible_v<T_Ok>);
   static_assert(std::is_move_constructible_v<T_Ok>);
-  static_assert(std::is_copy_assignable_v<T_Ok>);
   static_assert(std::is_move_assignable_v<T_Ok>);
 
   static_assert(!std::is_void_v<T_Error>);
-  static_assert(std::is_copy_constructible_v<T_Error>);
   static_assert(std::is_move_constructible_v<T_Error>);
-  static_assert(std::is_copy_assignable_v<T_Error>);
   static_assert(std::is_move_assignable_v<T_Error>);
+
+  static constexpr bool is_copyable =
+    std::is_copy_constructible_v<T_Ok> && std::is_copy_constructible_v<T_Error>;
+
+  static constexpr bool is_trivially_destructible =
+    std::is_trivially_destructible_v<T_Ok> &&
+    std::is_trivially_destructible_v<T_Error>;
+
+  static constexpr bool is_trivially_copy_constructible =
+    std::is_trivially_copy_constructible_v<T_Ok> &&
+    std::is_trivially_copy_constructible_v<T_Error>;
+
+  static constexpr bool is_trivially_move_constructible =
+    std::is_trivially_move_constructible_v<T_Ok> &&
+    std::is_trivially_move_constructible_v<T_Error>;
+
+  static constexpr bool is_trivially_copy_assignable =
+    is_trivially_copy_constructible && is_trivially_destructible &&
+    std::is_trivially_copy_assignable_v<T_Ok> &&
+    std::is_trivially_copy_assignable_v<T_Error>;
+
+  static constexpr bool is_trivially_move_assignable =
+    is_trivially_move_constructible && is_trivially_destructible &&
+    std::is_trivially_move_assignable_v<T_Ok> &&
+    std::is_trivially_move_assignable_v<T_Error>;
 public:
+  using value_type = T_Ok;
+  using error_type = T_Error;
+
   ///
   /// @brief default initialization to error state
   ///
@@ -153,12 +193,19 @@ public:
     new(&m_error_value) T_Error(std::move(rhs.error()));
   }
 
+  ///
+  /// @brief trivial copy contructor, used when both types are trivial
+  ///
+  result(const result& rhs) noexcept
+    requires is_trivially_copy_constructible = default;
+
   ///
   /// @brief copy contructor
   ///
   /// @param rhs the value to assign
   ///
   result(const result& rhs) noexcept
+    requires (is_copyable && !is_trivially_copy_constructible)
     : m_is_ok(rhs.m_is_ok)
   {
     if (m_is_ok) {
@@ -168,12 +215,19 @@ public:
     }
   }
 
+  ///
+  /// @brief trivial move contructor, used when both types are trivial
+  ///
+  result(result&& rhs) noexcept
+    requires is_trivially_move_constructible = default;
+
   ///
   /// @brief move contructor
   ///
   /// @param rhs the value to assign
   ///
   result(result&& rhs) noexcept
+    requires (!is_trivially_move_constructible)
     : m_is_ok(rhs.m_is_ok)
   {
     if (m_is_ok) {
@@ -183,10 +237,15 @@ public:
     }
   }
 
+  ///
+  /// @brief trivial destructor, used when both types are trivial
+  ///
+  ~result() requires is_trivially_destructible = default;
+
   ///
   /// @brief destructor
   ///
-  ~result() noexcept {
+  ~result() noexcept requires (!is_trivially_destructible) {
     if (m_is_ok) {
       m_ok_value.~T_Ok();
     } else {
@@ -239,12 +298,19 @@ public:
   }
 
 
+  ///
+  /// @brief trivial copy operator, used when both types are trivial
+  ///
+  result& operator=(const result& rhs) noexcept
+    requires is_trivially_copy_assignable = default;
+
   ///
   /// @brief copy operator
   ///
   /// @param rhs the value to assign
   ///
   result& operator=(const result& rhs) noexcept
+    requires (is_copyable && !is_trivially_copy_assignable)
   {
     if (rhs.m_is_ok) {
       assign_value(rhs.m_ok_value);
@@ -255,12 +321,19 @@ public:
     return *this;
   }
 
+  ///
+  /// @brief trivial move operator, used when both types are trivial
+  ///
+  result& operator=(result&& rhs) noexcept
+    requires is_trivially_move_assignable = default;
+
   ///
   /// @brief move operator
   ///
   /// @param rhs the value to assign
   ///
   result& operator=(result&& rhs) noexcept
+    requires (!is_trivially_move_assignable)
   {
     if (rhs.m_is_ok) {
       assign_value(std::move(rhs.m_ok_value));
@@ -447,6 +520,158 @@ public:
   constexpr explicit operator bool() const noexcept {
     return m_is_ok;
   }
+
+  ///
+  /// @brief call a function with the OK value
+  ///
+  /// @param f the function to call, it must return a result with the
+  ///        same error type
+  ///
+  /// @return the result of @a f, or the error of this result
+  ///
+  template<class T_Func>
+  auto and_then(T_Func&& f) & noexcept
+  {
+    return and_then_impl(*this, std::forward<T_Func>(f));
+  }
+
+  template<class T_Func>
+  auto and_then(T_Func&& f) const & noexcept
+  {
+    return and_then_impl(*this, std::forward<T_Func>(f));
+  }
+
+  template<class T_Func>
+  auto and_then(T_Func&& f) && noexcept
+  {
+    return and_then_impl(std::move(*this), std::forward<T_Func>(f));
+  }
+
+  ///
+  /// @brief transform the OK value
+  ///
+  /// @param f the function to call with the OK value
+  ///
+  /// @return a result holding the return value of @a f, or the error
+  ///         of this result
+  ///
+  template<class T_Func>
+  auto transform(T_Func&& f) & noexcept
+  {
+    return transform_impl(*this, std::forward<T_Func>(f));
+  }
+
+  template<class T_Func>
+  auto transform(T_Func&& f) const & noexcept
+  {
+    return transform_impl(*this, std::forward<T_Func>(f));
+  }
+
+  template<class T_Func>
+  auto transform(T_Func&& f) && noexcept
+  {
+    return transform_impl(std::move(*this), std::forward<T_Func>(f));
+  }
+
+  ///
+  /// @brief call a function with the error value
+  ///
+  /// @param f the function to call, it must return a result with the
+  ///        same OK type
+  ///
+  /// @return the result of @a f, or the OK value of this result
+  ///
+  template<class T_Func>
+  auto or_else(T_Func&& f) & noexcept
+  {
+    return or_else_impl(*this, std::forward<T_Func>(f));
+  }
+
+  template<class T_Func>
+  auto or_else(T_Func&& f) const & noexcept
+  {
+    return or_else_impl(*this, std::forward<T_Func>(f));
+  }
+
+  template<class T_Func>
+  auto or_else(T_Func&& f) && noexcept
+  {
+    return or_else_impl(std::move(*this), std::forward<T_Func>(f));
+  }
+private:
+  template<class T_Self>
+  static decltype(auto) forward_ok(T_Self&& self) noexcept
+  {
+    if constexpr (std::is_lvalue_reference_v<T_Self>) {
+      return (self.m_ok_value);
+    } else {
+      return std::move(self.m_ok_value);
+    }
+  }
+
+  template<class T_Self>
+  static decltype(auto) forward_error(T_Self&& self) noexcept
+  {
+    if constexpr (std::is_lvalue_reference_v<T_Self>) {
+      return (self.m_error_value);
+    } else {
+      return std::move(self.m_error_value);
+    }
+  }
+
+  template<class T_Self, class T_Func>
+  static auto and_then_impl(T_Self&& self, T_Func&& f) noexcept
+  {
+    using ret_type = std::remove_cvref_t<
+      std::invoke_result_t<T_Func, decltype(forward_ok(std::forward<T_Self>(self)))>>;
+
+    static_assert(internal::is_result_v<ret_type>);
+    static_assert(std::is_same_v<typename ret_type::error_type, T_Error>);
+
+    if (self.m_is_ok) {
+      return std::invoke(std::forward<T_Func>(f), forward_ok(std::forward<T_Self>(self)));
+    } else {
+      return ret_type(error_result<T_Error>(forward_error(std::forward<T_Self>(self))));
+    }
+  }
+
+  template<class T_Self, class T_Func>
+  static auto transform_impl(T_Self&& self, T_Func&& f) noexcept
+  {
+    using new_value_type = std::remove_cvref_t<
+      std::invoke_result_t<T_Func, decltype(forward_ok(std::forward<T_Self>(self)))>>;
+    using ret_type = result<new_value_type, T_Error>;
+
+    if (!self.m_is_ok) {
+      return ret_type(error_result<T_Error>(forward_error(std::forward<T_Self>(self))));
+    }
+
+    if constexpr (std::is_void_v<new_value_type>) {
+      std::invoke(std::forward<T_Func>(f), forward_ok(std::forward<T_Self>(self)));
+
+      ret_type res;
+      res.assign_value();
+      return res;
+    } else {
+      return ret_type(std::invoke(std::forward<T_Func>(f), forward_ok(std::forward<T_Self>(self))));
+    }
+  }
+
+  template<class T_Self, class T_Func>
+  static auto or_else_impl(T_Self&& self, T_Func&& f) noexcept
+  {
+    using ret_type = std::remove_cvref_t<
+      std::invoke_result_t<T_Func, decltype(forward_error(std::forward<T_Self>(self)))>>;
+
+    static_assert(internal::is_result_v<ret_type>);
+    static_assert(std::is_same_v<typename ret_type::value_type, T_Ok>);
+
+    if (self.m_is_ok) {
+      return ret_type(forward_ok(std::forward<T_Self>(self)));
+    } else {
+      return std::invoke(std::forward<T_Func>(f), forward_error(std::forward<T_Self>(self)));
+    }
+  }
 private:
   bool m_is_ok{false};
   union {
@@ -466,11 +691,12 @@ private:
 template<typename T_Error>
 class result<void, T_Error> {
   static_assert(!std::is_void_v<T_Error>);
-  static_assert(std::is_copy_constructible_v<T_Error>);
   static_assert(std::is_move_constructible_v<T_Error>);
-  static_assert(std::is_copy_assignable_v<T_Error>);
   static_assert(std::is_move_assignable_v<T_Error>);
 public:
+  using value_type = void;
+  using error_type = T_Error;
+
   ///
   /// @brief default initialization to error state
   ///
@@ -636,6 +862,82 @@ public:
   constexpr explicit operator bool() const noexcept {
     return m_is_ok;
   }
+
+  ///
+  /// @brief call a function when the result is OK
+  ///
+  /// @param f the function to call, it must return a result with the
+  ///        same error type
+  ///
+  /// @return the result of @a f, or the error of this result
+  ///
+  template<class T_Func>
+  auto and_then(T_Func&& f) const noexcept
+  {
+    using ret_type = std::remove_cvref_t<std::invoke_result_t<T_Func>>;
+
+    static_assert(internal::is_result_v<ret_type>);
+    static_assert(std::is_same_v<typename ret_type::error_type, T_Error>);
+
+    if (m_is_ok) {
+      return std::invoke(std::forward<T_Func>(f));
+    } else {
+      return ret_type(error_result<T_Error>(m_error_value));
+    }
+  }
+
+  ///
+  /// @brief call a function when the result is OK
+  ///
+  /// @param f the function to call
+  ///
+  /// @return a result holding the return value of @a f, or the error
+  ///         of this result
+  ///
+  template<class T_Func>
+  auto transform(T_Func&& f) const noexcept
+  {
+    using new_value_type = std::remove_cvref_t<std::invoke_result_t<T_Func>>;
+    using ret_type = result<new_value_type, T_Error>;
+
+    if (!m_is_ok) {
+      return ret_type(error_result<T_Error>(m_error_value));
+    }
+
+    if constexpr (std::is_void_v<new_value_type>) {
+      std::invoke(std::forward<T_Func>(f));
+
+      ret_type res;
+      res.assign_value();
+      return res;
+    } else {
+      return ret_type(std::invoke(std::forward<T_Func>(f)));
+    }
+  }
+
+  ///
+  /// @brief call a function with the error value
+  ///
+  /// @param f the function to call, it must return a result<void, ...>
+  ///
+  /// @return the result of @a f, or an OK result
+  ///
+  template<class T_Func>
+  auto or_else(T_Func&& f) const noexcept
+  {
+    using ret_type = std::remove_cvref_t<std::invoke_result_t<T_Func, const T_Error&>>;
+
+    static_assert(internal::is_result_v<ret_type>);
+    static_assert(std::is_void_v<typename ret_type::value_type>);
+
+    if (m_is_ok) {
+      ret_type res;
+      res.assign_value();
+      return res;
+    } else {
+      return std::invoke(std::forward<T_Func>(f), m_error_value);
+    }
+  }
 private:
   bool m_is_ok{false};
   T_Error m_error_value;
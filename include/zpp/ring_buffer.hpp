@@ -0,0 +1,354 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_RING_BUFFER_HPP
+#define ZPP_INCLUDE_ZPP_RING_BUFFER_HPP
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <zephyr/sys/__assert.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include <zpp/error_code.hpp>
+#include <zpp/result.hpp>
+#include <zpp/sem.hpp>
+#include <zpp/poll_signal.hpp>
+
+namespace zpp {
+
+///
+/// @brief ring notification that does nothing
+///
+struct ring_no_notify {
+  void notify() noexcept
+  {
+  }
+};
+
+///
+/// @brief ring notification that gives a binary semaphore when data
+///        was put in the ring
+///
+/// The reader takes the semaphore and then empties the ring.
+///
+class ring_sem_notify {
+public:
+  ring_sem_notify() noexcept
+    : m_sem(0, 1)
+  {
+  }
+
+  void notify() noexcept
+  {
+    m_sem.give();
+  }
+
+  ///
+  /// @brief the semaphore that is given
+  ///
+  /// @return reference to the semaphore
+  ///
+  auto& sem() noexcept
+  {
+    return m_sem;
+  }
+private:
+  zpp::sem m_sem;
+public:
+  ring_sem_notify(const ring_sem_notify&) = delete;
+  ring_sem_notify(ring_sem_notify&&) = delete;
+  ring_sem_notify& operator=(const ring_sem_notify&) = delete;
+  ring_sem_notify& operator=(ring_sem_notify&&) = delete;
+};
+
+#ifdef CONFIG_POLL
+///
+/// @brief ring notification that raises a poll signal when data was put
+///        in the ring
+///
+/// The reader polls the signal, resets it and then empties the ring.
+///
+class ring_poll_signal_notify {
+public:
+  ring_poll_signal_notify() noexcept = default;
+
+  void notify() noexcept
+  {
+    m_signal.raise(0);
+  }
+
+  ///
+  /// @brief the poll signal that is raised
+  ///
+  /// @return reference to the poll signal
+  ///
+  auto& signal() noexcept
+  {
+    return m_signal;
+  }
+private:
+  poll_signal m_signal;
+public:
+  ring_poll_signal_notify(const ring_poll_signal_notify&) = delete;
+  ring_poll_signal_notify(ring_poll_signal_notify&&) = delete;
+  ring_poll_signal_notify& operator=(const ring_poll_signal_notify&) = delete;
+  ring_poll_signal_notify& operator=(ring_poll_signal_notify&&) = delete;
+};
+#endif // CONFIG_POLL
+
+///
+/// @brief Ring of items on top of a Zephyr ring_buf
+///
+/// Next to copying items in and out, the claim and finish calls give
+/// direct access to the buffer, as spans of at most the items that are
+/// contiguous in memory. All calls work on whole items, so a claim never
+/// splits an item at the end of the buffer. Like ring_buf it does no
+/// locking, more than one producer or consumer must serialize access.
+///
+/// @param T_Item the item type, it must be trivially copyable
+/// @param T_Size the number of items, a power of two
+/// @param T_Notify called when items were put in the ring
+///
+template<class T_Item, size_t T_Size, class T_Notify = ring_no_notify>
+class item_ring {
+  static_assert(std::is_trivially_copyable_v<T_Item>);
+  static_assert(std::has_single_bit(T_Size));
+  static_assert(T_Size * sizeof(T_Item) <= RING_BUFFER_MAX_SIZE);
+public:
+  using value_type = T_Item;
+  using notify_type = T_Notify;
+public:
+  ///
+  /// @brief default constructor creating an empty ring
+  ///
+  item_ring() noexcept
+  {
+    ring_buf_init(&m_ring, sizeof(m_data), m_data);
+  }
+
+  ///
+  /// @brief the number of items the ring can hold
+  ///
+  /// @return the capacity in items
+  ///
+  static constexpr size_t capacity() noexcept
+  {
+    return T_Size;
+  }
+
+  ///
+  /// @brief the number of items in the ring
+  ///
+  /// @return the number of items
+  ///
+  [[nodiscard]] size_t size() noexcept
+  {
+    return ring_buf_size_get(&m_ring) / sizeof(T_Item);
+  }
+
+  ///
+  /// @brief the number of items that can still be put in the ring
+  ///
+  /// @return the free space in items
+  ///
+  [[nodiscard]] size_t space() noexcept
+  {
+    return ring_buf_space_get(&m_ring) / sizeof(T_Item);
+  }
+
+  ///
+  /// @brief check if the ring is empty
+  ///
+  /// @return true if there are no items in the ring
+  ///
+  [[nodiscard]] bool empty() noexcept
+  {
+    return ring_buf_is_empty(&m_ring);
+  }
+
+  ///
+  /// @brief drop all items, must not be used while items are claimed
+  ///
+  void reset() noexcept
+  {
+    ring_buf_reset(&m_ring);
+  }
+
+  ///
+  /// @brief claim free space to fill in place
+  ///
+  /// @param max_items the maximum number of items to claim
+  ///
+  /// @return the claimed items, empty when the ring is full
+  ///
+  [[nodiscard]] std::span<T_Item> put_claim(size_t max_items = T_Size) noexcept
+  {
+    uint8_t* data{ nullptr };
+    auto n = ring_buf_put_claim(&m_ring, &data, to_bytes(max_items));
+
+    return to_span(data, n);
+  }
+
+  ///
+  /// @brief put the first @a items claimed items in the ring
+  ///
+  /// Claimed items that are not finished are released.
+  ///
+  /// @param items the number of items to put
+  ///
+  /// @return error_code::k_inval if more items were finished than claimed
+  ///
+  [[nodiscard]] auto put_finish(size_t items) noexcept
+  {
+    auto res = to_result(ring_buf_put_finish(&m_ring, to_bytes(items)));
+    if (res && items > 0) {
+      m_notify.notify();
+    }
+
+    return res;
+  }
+
+  ///
+  /// @brief copy items into the ring
+  ///
+  /// @param items the items to put
+  ///
+  /// @return the number of items that fitted
+  ///
+  size_t put(std::span<const T_Item> items) noexcept
+  {
+    auto n = ring_buf_put(&m_ring,
+                          reinterpret_cast<const uint8_t*>(items.data()),
+                          to_bytes(items.size()));
+    if (n > 0) {
+      m_notify.notify();
+    }
+
+    return n / sizeof(T_Item);
+  }
+
+  ///
+  /// @brief claim items to read in place
+  ///
+  /// @param max_items the maximum number of items to claim
+  ///
+  /// @return the claimed items, empty when the ring is empty
+  ///
+  [[nodiscard]] std::span<T_Item> get_claim(size_t max_items = T_Size) noexcept
+  {
+    uint8_t* data{ nullptr };
+    auto n = ring_buf_get_claim(&m_ring, &data, to_bytes(max_items));
+
+    return to_span(data, n);
+  }
+
+  ///
+  /// @brief remove the first @a items claimed items from the ring
+  ///
+  /// Claimed items that are not finished stay in the ring.
+  ///
+  /// @param items the number of items to remove
+  ///
+  /// @return error_code::k_inval if more items were finished than claimed
+  ///
+  [[nodiscard]] auto get_finish(size_t items) noexcept
+  {
+    return to_result(ring_buf_get_finish(&m_ring, to_bytes(items)));
+  }
+
+  ///
+  /// @brief copy items out of the ring
+  ///
+  /// @param items where to put the items
+  ///
+  /// @return the number of items copied
+  ///
+  size_t get(std::span<T_Item> items) noexcept
+  {
+    auto n = ring_buf_get(&m_ring,
+                          reinterpret_cast<uint8_t*>(items.data()),
+                          to_bytes(items.size()));
+
+    return n / sizeof(T_Item);
+  }
+
+  ///
+  /// @brief the notification object
+  ///
+  /// @return reference to the notification object
+  ///
+  auto& notifier() noexcept
+  {
+    return m_notify;
+  }
+
+  ///
+  /// @brief get the native zephyr ring buffer handle.
+  ///
+  /// @return A pointer to the zephyr ring_buf.
+  ///
+  auto native_handle() noexcept
+  {
+    return &m_ring;
+  }
+private:
+  static constexpr uint32_t to_bytes(size_t items) noexcept
+  {
+    return static_cast<uint32_t>(std::min(items, T_Size) * sizeof(T_Item));
+  }
+
+  static std::span<T_Item> to_span(uint8_t* data, uint32_t bytes) noexcept
+  {
+    __ASSERT_NO_MSG(bytes % sizeof(T_Item) == 0);
+
+    if (bytes == 0) {
+      return {};
+    }
+
+    return { reinterpret_cast<T_Item*>(data), bytes / sizeof(T_Item) };
+  }
+
+  static result<void, error_code> to_result(int rc) noexcept
+  {
+    result<void, error_code> res;
+
+    if (rc == 0) {
+      res.assign_value();
+    } else {
+      res.assign_error(to_error_code(-rc));
+    }
+
+    return res;
+  }
+private:
+  struct ring_buf                   m_ring{};
+  alignas(T_Item) uint8_t           m_data[T_Size * sizeof(T_Item)]{};
+  [[no_unique_address]] T_Notify    m_notify;
+public:
+  item_ring(const item_ring&) = delete;
+  item_ring(item_ring&&) = delete;
+  item_ring& operator=(const item_ring&) = delete;
+  item_ring& operator=(item_ring&&) = delete;
+};
+
+///
+/// @brief Ring of bytes on top of a Zephyr ring_buf
+///
+/// @param T_Size the number of bytes, a power of two
+/// @param T_Notify called when bytes were put in the ring
+///
+template<size_t T_Size, class T_Notify = ring_no_notify>
+using byte_ring = item_ring<uint8_t, T_Size, T_Notify>;
+
+} // namespace zpp
+
+#endif // ZPP_INCLUDE_ZPP_RING_BUFFER_HPP
@@ -7,7 +7,9 @@
 #ifndef ZPP_INCLUDE_ZPP_SEM_HPP
 #define ZPP_INCLUDE_ZPP_SEM_HPP
 
+#include <zpp/clock.hpp>
 #include <zpp/thread.hpp>
+#include <zpp/lock_stats.hpp>
 
 #include <zephyr/kernel.h>
 #include <zephyr/sys/__assert.h>
@@ -20,13 +22,17 @@ namespace zpp {
 ///
 /// @brief Counting semaphore base class
 ///
-template<typename T_Sem>
+/// @param T_Sem the derived semaphore class
+/// @param T_LockStats the statistics policy, no_lock_stats or lock_stats
+///
+template<typename T_Sem, typename T_LockStats = no_lock_stats>
 class sem_base
 {
 public:
   using native_type = struct k_sem;
   using native_pointer = native_type*;
   using native_const_pointer = native_type const *;
+  using lock_stats_type = T_LockStats;
 
   ///
   /// @brief Type used as counter
@@ -43,6 +49,7 @@ protected:
   /// @brief Default constructor, only allowed derived objects
   ///
   constexpr sem_base() noexcept
+    : m_stats(lock_kind::sem, this)
   {
   }
 public:
@@ -53,7 +60,7 @@ public:
   ///
   [[nodiscard]] bool take() noexcept
   {
-    if (k_sem_take(native_handle(), K_FOREVER) == 0) {
+    if (take_native(K_FOREVER) == 0) {
       return true;
     } else {
       return false;
@@ -67,7 +74,7 @@ public:
   ///
   [[nodiscard]] bool try_take() noexcept
   {
-    if (k_sem_take(native_handle(), K_NO_WAIT) == 0) {
+    if (take_native(K_NO_WAIT) == 0) {
       return true;
     } else {
       return false;
@@ -86,7 +93,26 @@ public:
   try_take_for(const std::chrono::duration<T_Rep, T_Period>&
             timeout_duration) noexcept
   {
-    if (k_sem_take(native_handle(), to_timeout(timeout_duration)) == 0) {
+    if (take_native(to_timeout(timeout_duration)) == 0) {
+      return true;
+    } else {
+      return false;
+    }
+  }
+
+  ///
+  /// @brief Try to take the semaphore waiting until a certain time
+  ///
+  /// @param abs_time The time point to wait until before giving up
+  ///
+  /// @return true when semaphore was taken
+  ///
+  template<class T_Clock, class T_Duration>
+  [[nodiscard]] bool
+  try_take_until(const std::chrono::time_point<T_Clock, T_Duration>&
+            abs_time) noexcept
+  {
+    if (take_native(to_timeout(abs_time)) == 0) {
       return true;
     } else {
       return false;
@@ -132,9 +158,9 @@ public:
   ///
   void operator--(int) noexcept
   {
-    while (!take()) {
-      this_thread::yield();
-    }
+    auto res = take();
+    __ASSERT_NO_MSG(res);
+    (void)res;
   }
 
   ///
@@ -152,14 +178,17 @@ public:
   ///
   /// @brief Take the semaphore n times, waiting forever.
   ///
+  /// Every unit is taken on its own, use counting_sem to take several
+  /// units at once.
+  ///
   /// @param n The number of times to take the semaphore
   ///
   void operator-=(int n) noexcept
   {
     while (n-- > 0) {
-      while (!take()) {
-        this_thread::yield();
-      }
+      auto res = take();
+      __ASSERT_NO_MSG(res);
+      (void)res;
     }
   }
 
@@ -182,6 +211,40 @@ public:
   {
     return static_cast<const T_Sem*>(this)->native_handle();
   }
+
+  ///
+  /// @brief get the statistics of this semaphore
+  ///
+  /// @return the statistics policy object
+  ///
+  constexpr auto stats() noexcept -> lock_stats_type&
+  {
+    return m_stats;
+  }
+private:
+  int take_native(k_timeout_t timeout) noexcept
+  {
+    if constexpr (T_LockStats::enabled) {
+      auto start = T_LockStats::now();
+      bool contended = false;
+
+      auto rc = k_sem_take(native_handle(), K_NO_WAIT);
+      if (rc != 0 && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+        contended = true;
+        rc = k_sem_take(native_handle(), timeout);
+      }
+
+      if (rc == 0) {
+        m_stats.acquired(start, contended);
+      }
+
+      return rc;
+    } else {
+      return k_sem_take(native_handle(), timeout);
+    }
+  }
+private:
+  [[no_unique_address]] T_LockStats m_stats;
 public:
   sem_base(const sem_base&) = delete;
   sem_base(sem_base&&) = delete;
@@ -193,7 +256,7 @@ public:
 ///
 /// @brief A counting semaphore class.
 ///
-class sem : public sem_base<sem> {
+class sem : public sem_base<sem, default_lock_stats> {
 public:
   ///
   /// @brief Constructor initializing initial count and count limit.
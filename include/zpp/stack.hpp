@@ -0,0 +1,338 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_STACK_HPP
+#define ZPP_INCLUDE_ZPP_STACK_HPP
+
+#include <zpp/clock.hpp>
+#include <zpp/result.hpp>
+#include <zpp/error_code.hpp>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace zpp {
+
+///
+/// @brief Stack CRTP base class
+///
+/// A k_stack stores the values in an array, so unlike a lifo the items
+/// do not need a reserved member. The last value pushed is the first one
+/// popped, so when used as a free list the buffer handed out is the one
+/// released most recently.
+///
+/// @param T_Stack the CRTP derived type
+/// @param T_Item the item type, stack_data_t or a pointer type
+///
+template<typename T_Stack, typename T_Item>
+class stack_base {
+public:
+  using native_type = struct k_stack;
+  using native_pointer = native_type *;
+  using native_const_pointer = native_type const *;
+
+  using item_type = T_Item;
+
+  static_assert(std::is_same_v<item_type, stack_data_t>
+                || std::is_pointer_v<item_type>,
+                "item must be stack_data_t or a pointer");
+protected:
+  ///
+  /// @brief default constructor, can only be called from derived types
+  ///
+  constexpr stack_base() noexcept = default;
+public:
+  ///
+  /// @brief get the Zephyr native stack handle
+  ///
+  /// @return pointer to a k_stack
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return static_cast<T_Stack*>(this)->native_handle();
+  }
+
+  ///
+  /// @brief get the Zephyr native stack handle
+  ///
+  /// @return pointer to a k_stack
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return static_cast<const T_Stack*>(this)->native_handle();
+  }
+
+  ///
+  /// @brief push an item on the stack
+  ///
+  /// @param item the item to push
+  ///
+  /// @return error_code::k_nomem when the stack is full
+  ///
+  [[nodiscard]] auto push(item_type item) noexcept
+  {
+    result<void, error_code> res;
+
+    auto rc = k_stack_push(native_handle(), to_data(item));
+    if (rc == 0) {
+      res.assign_value();
+    } else {
+      res.assign_error(to_error_code(-rc));
+    }
+
+    return res;
+  }
+
+  ///
+  /// @brief pop the top item waiting for ever
+  ///
+  /// @return the item or an error code
+  ///
+  [[nodiscard]] auto pop() noexcept
+  {
+    return pop_native(K_FOREVER);
+  }
+
+  ///
+  /// @brief try to pop the top item without waiting
+  ///
+  /// @return the item or an error code
+  ///
+  [[nodiscard]] auto try_pop() noexcept
+  {
+    return pop_native(K_NO_WAIT);
+  }
+
+  ///
+  /// @brief try to pop the top item waiting a certain amount of time
+  ///
+  /// @param timeout The timeout before returning
+  ///
+  /// @return the item or an error code
+  ///
+  template<class T_Rep, class T_Period>
+  [[nodiscard]] auto
+  try_pop_for(const std::chrono::duration<T_Rep, T_Period>& timeout) noexcept
+  {
+    return pop_native(to_timeout(timeout));
+  }
+
+  ///
+  /// @brief try to pop the top item waiting until a certain time
+  ///
+  /// @param abs_time The time point to wait until
+  ///
+  /// @return the item or an error code
+  ///
+  template<class T_Clock, class T_Duration>
+  [[nodiscard]] auto
+  try_pop_until(const std::chrono::time_point<T_Clock, T_Duration>& abs_time) noexcept
+  {
+    return pop_native(to_timeout(abs_time));
+  }
+private:
+  static stack_data_t to_data(item_type item) noexcept
+  {
+    if constexpr (std::is_pointer_v<item_type>) {
+      return reinterpret_cast<stack_data_t>(item);
+    } else {
+      return item;
+    }
+  }
+
+  static item_type from_data(stack_data_t data) noexcept
+  {
+    if constexpr (std::is_pointer_v<item_type>) {
+      return reinterpret_cast<item_type>(data);
+    } else {
+      return data;
+    }
+  }
+
+  auto pop_native(k_timeout_t timeout) noexcept
+  {
+    result<item_type, error_code> res;
+
+    stack_data_t data{};
+    auto rc = k_stack_pop(native_handle(), &data, timeout);
+    if (rc == 0) {
+      res.assign_value(from_data(data));
+    } else {
+      res.assign_error(to_error_code(-rc));
+    }
+
+    return res;
+  }
+public:
+  stack_base(const stack_base&) = delete;
+  stack_base(stack_base&&) = delete;
+  stack_base& operator=(const stack_base&) = delete;
+  stack_base& operator=(stack_base&&) = delete;
+};
+
+///
+/// @brief stack that manages a k_stack object and its storage
+///
+/// @param T_Size the maximum number of items on the stack
+/// @param T_Item the item type, stack_data_t or a pointer type
+///
+template<size_t T_Size, typename T_Item = stack_data_t>
+class stack : public stack_base<stack<T_Size, T_Item>, T_Item> {
+public:
+  using typename stack_base<stack<T_Size, T_Item>, T_Item>::native_type;
+  using typename stack_base<stack<T_Size, T_Item>, T_Item>::native_pointer;
+  using typename stack_base<stack<T_Size, T_Item>, T_Item>::native_const_pointer;
+
+  static_assert(T_Size > 0);
+
+  ///
+  /// @brief the maximum number of items on the stack
+  ///
+  static constexpr size_t max_size = T_Size;
+public:
+  ///
+  /// @brief create new stack
+  ///
+  stack() noexcept
+  {
+    k_stack_init(&m_stack, m_data.data(), T_Size);
+  }
+
+  ///
+  /// @brief get the Zephyr native stack handle
+  ///
+  /// @return pointer to a k_stack
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return &m_stack;
+  }
+
+  ///
+  /// @brief get the Zephyr native stack handle
+  ///
+  /// @return pointer to a k_stack
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return &m_stack;
+  }
+private:
+  native_type                         m_stack;
+  std::array<stack_data_t, T_Size>    m_data;
+public:
+  stack(const stack&) = delete;
+  stack(stack&&) = delete;
+  stack& operator=(const stack&) = delete;
+  stack& operator=(stack&&) = delete;
+};
+
+///
+/// @brief stack that references a k_stack object
+///
+/// @param T_Item the item type, stack_data_t or a pointer type
+///
+template<typename T_Item = stack_data_t>
+class stack_ref : public stack_base<stack_ref<T_Item>, T_Item> {
+public:
+  using typename stack_base<stack_ref<T_Item>, T_Item>::native_type;
+  using typename stack_base<stack_ref<T_Item>, T_Item>::native_pointer;
+  using typename stack_base<stack_ref<T_Item>, T_Item>::native_const_pointer;
+public:
+  ///
+  /// @brief wrap k_stack
+  ///
+  /// @param s the k_stack to reference
+  ///
+  /// @warning @a s must stay valid for the lifetime of this object
+  ///
+  constexpr explicit stack_ref(native_pointer s) noexcept
+    : m_stack_ptr(s)
+  {
+    __ASSERT_NO_MSG(m_stack_ptr != nullptr);
+  }
+
+  ///
+  /// @brief Reference another stack object
+  ///
+  /// @param s the object to reference
+  ///
+  /// @warning @a s must stay valid for the lifetime of this object
+  ///
+  template<size_t T_Size>
+  constexpr explicit stack_ref(stack<T_Size, T_Item>& s) noexcept
+    : m_stack_ptr(s.native_handle())
+  {
+    __ASSERT_NO_MSG(m_stack_ptr != nullptr);
+  }
+
+  ///
+  /// @brief Reference another stack object
+  ///
+  /// @param s the object to reference
+  ///
+  /// @return *this
+  ///
+  /// @warning @a s must stay valid for the lifetime of this object
+  ///
+  constexpr stack_ref& operator=(native_pointer s) noexcept
+  {
+    m_stack_ptr = s;
+    __ASSERT_NO_MSG(m_stack_ptr != nullptr);
+    return *this;
+  }
+
+  ///
+  /// @brief Reference another stack object
+  ///
+  /// @param s the object to reference
+  ///
+  /// @return *this
+  ///
+  /// @warning @a s must stay valid for the lifetime of this object
+  ///
+  template<size_t T_Size>
+  constexpr stack_ref& operator=(stack<T_Size, T_Item>& s) noexcept
+  {
+    m_stack_ptr = s.native_handle();
+    __ASSERT_NO_MSG(m_stack_ptr != nullptr);
+    return *this;
+  }
+
+  ///
+  /// @brief get the Zephyr native stack handle
+  ///
+  /// @return pointer to a k_stack
+  ///
+  [[nodiscard]] constexpr auto native_handle() noexcept -> native_pointer
+  {
+    return m_stack_ptr;
+  }
+
+  ///
+  /// @brief get the Zephyr native stack handle
+  ///
+  /// @return pointer to a k_stack
+  ///
+  [[nodiscard]] constexpr auto native_handle() const noexcept -> native_const_pointer
+  {
+    return m_stack_ptr;
+  }
+private:
+  native_pointer m_stack_ptr{ nullptr };
+public:
+  stack_ref() = delete;
+};
+
+} // namespace zpp
+
+#endif // ZPP_INCLUDE_ZPP_STACK_HPP
@@ -14,23 +14,33 @@
 
 #include <chrono>
 
+#include <zpp/clock.hpp>
+#include <zpp/lock_stats.hpp>
+
 namespace zpp {
 
 ///
 /// @brief A userspace mutex class.
 ///
-template<typename T_Mutex>
+/// @param T_Mutex the derived mutex class
+/// @param T_LockStats the statistics policy, no_lock_stats or lock_stats
+///
+template<typename T_Mutex, typename T_LockStats = no_lock_stats>
 class sys_mutex_base
 {
 public:
   using native_type = struct sys_mutex;
   using native_pointer = native_type*;
-  using native_cont_pointer = native_type const *;
+  using native_const_pointer = native_type const *;
+  using lock_stats_type = T_LockStats;
 protected:
   ///
   /// @brief Protected default contructor so only derived objects can be created
   ///
-  constexpr sys_mutex_base() noexcept = default;
+  constexpr sys_mutex_base() noexcept
+    : m_stats(lock_kind::sys_mutex, this)
+  {
+  }
 
 public:
   ///
@@ -40,7 +50,7 @@ public:
   ///
   [[nodiscard]] bool lock() noexcept
   {
-    if (sys_mutex_lock(native_handle(), K_FOREVER) == 0) {
+    if (lock_native(K_FOREVER) == 0) {
       return true;
     } else {
       return false;
@@ -54,7 +64,7 @@ public:
   ///
   [[nodiscard]] bool try_lock() noexcept
   {
-    if (sys_mutex_lock(native_handle(), K_NO_WAIT) == 0) {
+    if (lock_native(K_NO_WAIT) == 0) {
       return true;
     } else {
       return false;
@@ -74,7 +84,7 @@ public:
   {
     using namespace std::chrono;
 
-    if (sys_mutex_lock(native_handle(), to_timeout(timeout)) == 0)
+    if (lock_native(to_timeout(timeout)) == 0)
     {
       return true;
     } else {
@@ -82,11 +92,33 @@ public:
     }
   }
 
+  ///
+  /// @brief Try locking the mutex until a certain time.
+  ///
+  /// @param abs_time The time point to wait until before returning
+  ///
+  /// @return true if successfully locked.
+  ///
+  template<class T_Clock, class T_Duration>
+  [[nodiscard]] bool
+  try_lock_until(const std::chrono::time_point<T_Clock, T_Duration>& abs_time) noexcept
+  {
+    if (lock_native(to_timeout(abs_time)) == 0) {
+      return true;
+    } else {
+      return false;
+    }
+  }
+
   ///
   /// @brief Unlock the mutex.
   ///
   [[nodiscard]] bool unlock() noexcept
   {
+    if constexpr (T_LockStats::enabled) {
+      m_stats.unlocking();
+    }
+
     if (sys_mutex_unlock(native_handle()) == 0) {
       return true;
     } else {
@@ -113,6 +145,40 @@ public:
   {
     return static_cast<const T_Mutex*>(this)->native_handle();
   }
+
+  ///
+  /// @brief get the lock statistics of this mutex
+  ///
+  /// @return the statistics policy object
+  ///
+  constexpr auto stats() noexcept -> lock_stats_type&
+  {
+    return m_stats;
+  }
+private:
+  int lock_native(k_timeout_t timeout) noexcept
+  {
+    if constexpr (T_LockStats::enabled) {
+      auto start = T_LockStats::now();
+      bool contended = false;
+
+      auto rc = sys_mutex_lock(native_handle(), K_NO_WAIT);
+      if (rc != 0 && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+        contended = true;
+        rc = sys_mutex_lock(native_handle(), timeout);
+      }
+
+      if (rc == 0) {
+        m_stats.locked(start, contended);
+      }
+
+      return rc;
+    } else {
+      return sys_mutex_lock(native_handle(), timeout);
+    }
+  }
+private:
+  [[no_unique_address]] T_LockStats m_stats;
 public:
   sys_mutex_base(const sys_mutex_base&) = delete;
   sys_mutex_base(sys_mutex_base&&) = delete;
@@ -123,7 +189,7 @@ public:
 ///
 /// @brief A recursive mutex class.
 ///
-class sys_mutex : public sys_mutex_base<sys_mutex> {
+class sys_mutex : public sys_mutex_base<sys_mutex, default_lock_stats> {
 public:
   ///
   /// @brief Default constructor
@@ -12,6 +12,7 @@
 #include <zpp/thread_attr.hpp>
 #include <zpp/thread_data.hpp>
 #include <zpp/thread_stack.hpp>
+#include <zpp/thread_runtime_stats.hpp>
 #include <zpp/clock.hpp>
 #include <zpp/result.hpp>
 #include <zpp/error_code.hpp>
@@ -92,6 +93,14 @@ sleep_until( const std::chrono::time_point<T_Clock, T_Duration>& sleep_time)
 {
   using namespace std::chrono;
 
+#ifdef CONFIG_TIMEOUT_64BIT
+  // uptime_clock is the kernel clock, so a single absolute timeout does it
+  if constexpr (std::is_same_v<T_Clock, uptime_clock>) {
+    k_sleep(to_timeout(sleep_time));
+    return;
+  }
+#endif
+
   T_Duration dt;
   while ( (dt = sleep_time - T_Clock::now()) > T_Duration::zero()) {
     k_sleep(to_timeout(dt));
@@ -134,6 +143,48 @@ inline void set_priority(thread_prio prio) noexcept
   k_thread_priority_set(k_current_get(), prio.native_value());
 }
 
+#ifdef CONFIG_SCHED_DEADLINE
+///
+/// @brief Set the EDF deadline of the current thread
+///
+/// The deadline is relative to now and only orders threads of the
+/// same priority.
+///
+/// @param deadline The deadline relative to now
+///
+template<class T_Rep, class T_Period>
+inline void
+set_deadline(const std::chrono::duration<T_Rep, T_Period>& deadline) noexcept
+{
+  k_thread_deadline_set(k_current_get(), internal::to_deadline_cycles(deadline));
+}
+#endif // CONFIG_SCHED_DEADLINE
+
+#ifdef CONFIG_THREAD_RUNTIME_STATS
+///
+/// @brief Get the runtime statistics of the current thread
+///
+/// @return The runtime statistics or an error code
+///
+inline auto runtime_stats() noexcept
+{
+  return internal::get_runtime_stats(k_current_get());
+}
+#endif // CONFIG_THREAD_RUNTIME_STATS
+
+///
+/// @brief Get the number of stack bytes the current thread never used
+///
+/// Needs CONFIG_INIT_STACKS and CONFIG_THREAD_STACK_INFO, otherwise
+/// error_code::k_notsup is returned.
+///
+/// @return The unused stack size in bytes or an error code
+///
+inline auto stack_unused() noexcept
+{
+  return internal::get_stack_unused(k_current_get());
+}
+
 } // namespace this_thread
 
 template <class T> typename std::decay<T>::type decay_copy(T&& v) noexcept
@@ -192,6 +243,72 @@ private:
     std::invoke(*f);
   }
 
+  static thread_id create(
+      thread_data& td,
+      thread_stack& tstack,
+      const thread_attr& attr,
+      k_thread_entry_t entry,
+      void* p1,
+      void* p2) noexcept
+  {
+    auto delay = attr.native_delay();
+
+    // the CPU mask can only be changed while the thread is not runnable,
+    // and the deadline must be set before the thread runs the first time
+    bool setup = false;
+#ifdef CONFIG_SCHED_CPU_MASK
+    setup = setup || attr.has_cpu_mask();
+#endif
+#ifdef CONFIG_SCHED_DEADLINE
+    setup = setup || attr.has_deadline();
+#endif
+
+    bool start = false;
+    if (setup) {
+      // a delayed start would have to be done with k_thread_start() from
+      // a timer, so the combination is refused instead of leaving the
+      // thread suspended for ever
+      if (attr.has_start_delay()) {
+        return thread_id::any();
+      }
+
+      start = K_TIMEOUT_EQ(delay, K_NO_WAIT);
+      delay = K_FOREVER;
+    }
+
+    auto tid = k_thread_create(
+          td.native_handle(),
+          tstack.data(),
+          tstack.size(),
+          entry,
+          p1,
+          p2,
+          nullptr,
+          attr.native_prio(),
+          attr.native_options(),
+          delay);
+
+    if (setup) {
+#ifdef CONFIG_SCHED_CPU_MASK
+      if (attr.has_cpu_mask()) {
+        auto rc = internal::apply_cpu_mask(tid, attr.cpu_mask());
+        __ASSERT_NO_MSG(rc == 0);
+        (void)rc;
+      }
+#endif
+#ifdef CONFIG_SCHED_DEADLINE
+      if (attr.has_deadline()) {
+        k_thread_deadline_set(tid, attr.native_deadline());
+      }
+#endif
+      if (start) {
+        k_thread_start(tid);
+      }
+    }
+
+    return thread_id(tid);
+  }
+
 public:
   ///
   /// @brief Creates a object which doesn't represent a Zephyr thread.
@@ -253,19 +370,15 @@ public:
 
       __ASSERT_NO_MSG(cip != nullptr);
 
-      auto tid = k_thread_create(
-            td.native_handle(),
-            tstack.data(),
-            tstack.size(),
+      m_tid = create(td, tstack, attr,
             &callback_helper<call_info>,
             reinterpret_cast<void*>(cip),
-            nullptr,
-            nullptr,
-            attr.native_prio(),
-            attr.native_options(),
-            attr.native_delay());
+            nullptr);
 
-      m_tid = thread_id(tid);
+      if (!m_tid) {
+        std::destroy_at(cip);
+        heap->deallocate(cip);
+      }
     }
   }
 
@@ -304,19 +417,10 @@ public:
     void* arg_vp{};
     std::construct_at(reinterpret_cast<T_CallbackArg*>(&arg_vp), arg);
 
-    auto tid = k_thread_create(
-          td.native_handle(),
-          tstack.data(),
-          tstack.size(),
+    m_tid = create(td, tstack, attr,
           &callback_helper<func_t, T_CallbackArg>,
           reinterpret_cast<void*>(fp),
-          arg_vp,
-          nullptr,
-          attr.native_prio(),
-          attr.native_options(),
-          attr.native_delay());
-
-    m_tid = thread_id(tid);
+          arg_vp);
   }
 
 
@@ -347,19 +451,10 @@ public:
 
     func_t fp = f;
 
-    auto tid = k_thread_create(
-          td.native_handle(),
-          tstack.data(),
-          tstack.size(),
+    m_tid = create(td, tstack, attr,
           &callback_helper_void<func_t>,
           reinterpret_cast<void*>(fp),
-          nullptr,
-          nullptr,
-          attr.native_prio(),
-          attr.native_options(),
-          attr.native_delay());
-
-    m_tid = thread_id(tid);
+          nullptr);
   }
 
 
@@ -583,6 +678,112 @@ public:
       }
     }
 
+    return res;
+  }
+
+#ifdef CONFIG_SCHED_CPU_MASK
+  ///
+  /// @brief Set the CPUs the thread this object manages may run on.
+  ///
+  /// The thread must not be runnable, so it must be created suspended
+  /// or be suspended.
+  ///
+  /// @param mask The CPU mask
+  ///
+  [[nodiscard]] auto set_cpu_mask(thread_cpu_mask mask) noexcept
+  {
+    result<void, error_code> res(error_result(error_code::k_inval));
+
+    if (m_tid) {
+      auto rc = internal::apply_cpu_mask(m_tid.native_handle(), mask);
+      if (rc == 0) {
+        res.assign_value();
+      } else {
+        res.assign_error(to_error_code(-rc));
+      }
+    }
+
+    return res;
+  }
+
+  ///
+  /// @brief Pin the thread this object manages to a single CPU.
+  ///
+  /// The thread must not be runnable, so it must be created suspended
+  /// or be suspended.
+  ///
+  /// @param cpu The CPU to run on
+  ///
+  [[nodiscard]] auto pin_to_cpu(size_t cpu) noexcept
+  {
+    if (cpu >= thread_cpu_mask::max_cpus) {
+      return result<void, error_code>(error_result(error_code::k_inval));
+    }
+
+    return set_cpu_mask(thread_cpu_mask::cpu(cpu));
+  }
+#endif // CONFIG_SCHED_CPU_MASK
+
+#ifdef CONFIG_SCHED_DEADLINE
+  ///
+  /// @brief Set the EDF deadline of the thread this object manages.
+  ///
+  /// The deadline is relative to now and only orders threads of the
+  /// same priority.
+  ///
+  /// @param deadline The deadline relative to now
+  ///
+  template<class T_Rep, class T_Period>
+  [[nodiscard]] auto
+  set_deadline(const std::chrono::duration<T_Rep, T_Period>& deadline) noexcept
+  {
+    result<void, error_code> res(error_result(error_code::k_inval));
+
+    if (m_tid) {
+      k_thread_deadline_set(m_tid.native_handle(),
+                            internal::to_deadline_cycles(deadline));
+      res.assign_value();
+    }
+
+    return res;
+  }
+#endif // CONFIG_SCHED_DEADLINE
+
+#ifdef CONFIG_THREAD_RUNTIME_STATS
+  ///
+  /// @brief Get the runtime statistics of the thread this object manages.
+  ///
+  /// @return The runtime statistics or an error code
+  ///
+  [[nodiscard]] auto runtime_stats() const noexcept
+  {
+    result<thread_runtime_stats, error_code> res(error_result(error_code::k_inval));
+
+    if (m_tid) {
+      res = internal::get_runtime_stats(m_tid.native_handle());
+    }
+
+    return res;
+  }
+#endif // CONFIG_THREAD_RUNTIME_STATS
+
+  ///
+  /// @brief Get the number of stack bytes the thread this object manages
+  ///        never used.
+  ///
+  /// Needs CONFIG_INIT_STACKS and CONFIG_THREAD_STACK_INFO, otherwise
+  /// error_code::k_notsup is returned.
+  ///
+  /// @return The unused stack size in bytes or an error code
+  ///
+  [[nodiscard]] auto stack_unused() const noexcept
+  {
+    result<size_t, error_code> res(error_result(error_code::k_inval));
+
+    if (m_tid) {
+      res = internal::get_stack_unused(m_tid.native_handle());
+    }
+
     return res;
   }
 private:
@@ -592,6 +793,100 @@ public:
   thread& operator=(const thread&) = delete;
 };
 
+///
+/// @brief Call a function for every thread in the system
+///
+/// k_thread_foreach() holds the thread monitor spinlock with interrupts
+/// disabled while iterating. @a f must not block or reschedule and must
+/// not call kernel functions that take that lock, like creating or
+/// aborting a thread. k_thread_foreach_unlocked() can be used directly
+/// when the callback needs more. Threads are only tracked when
+/// CONFIG_THREAD_MONITOR is enabled, without it @a f is never called.
+///
+/// @param f The function to call with the thread_id of each thread
+///
+template<class T_Callback>
+inline void for_each_thread(T_Callback f) noexcept
+{
+  static_assert(std::is_nothrow_invocable_v<T_Callback, thread_id>);
+
+  k_thread_foreach(
+    [](const struct k_thread* t, void* user_data) noexcept {
+      auto cb = reinterpret_cast<T_Callback*>(user_data);
+      std::invoke(*cb, thread_id(const_cast<k_tid_t>(t)));
+    },
+    reinterpret_cast<void*>(&f));
+}
+
+namespace internal {
+
+///
+/// @brief entry point of a thread defined with ZPP_THREAD_DEFINE
+///
+template<auto& F>
+void static_thread_entry(void* p1, void* p2, void* p3) noexcept
+{
+  (void)p1;
+  (void)p2;
+  (void)p3;
+
+  std::invoke(F);
+}
+
+///
+/// @brief check if the attributes can be used for a static thread
+///
+/// The CPU mask and deadline are applied after k_thread_create(), the
+/// kernel creates static threads without calling back into zpp.
+///
+consteval bool is_static_thread_attr(const thread_attr& attr) noexcept
+{
+#ifdef CONFIG_SCHED_CPU_MASK
+  if (attr.has_cpu_mask()) {
+    return false;
+  }
+#endif
+#ifdef CONFIG_SCHED_DEADLINE
+  if (attr.has_deadline()) {
+    return false;
+  }
+#endif
+  (void)attr;
+
+  return true;
+}
+
+} // namespace internal
+
 } // namespace zpp
 
+///
+/// @brief Define a thread that the kernel creates at boot
+///
+/// The thread, its stack and its TCB are static, so there is no
+/// k_thread_create() call at runtime. @a attr must be a constant
+/// expression and @a f a function or lambda without captures that is
+/// noexcept and takes no arguments. Defines the function name() that
+/// returns the zpp::thread_id of the thread.
+///
+/// @param name The name of the thread
+/// @param stack_size The stack size in bytes
+/// @param attr The zpp::thread_attr of the thread
+/// @param f The thread entry point
+///
+#define ZPP_THREAD_DEFINE(name, stack_size, attr, f)                      \
+  constexpr auto name##_entry = (f);                                      \
+  static_assert(std::is_nothrow_invocable_v<decltype(name##_entry)>,     \
+                "entry must be noexcept and take no arguments");          \
+  static_assert(zpp::internal::is_static_thread_attr(attr),              \
+                "a static thread can not have a cpu mask or deadline");   \
+  K_THREAD_DEFINE(name##_native, (stack_size),                            \
+                  zpp::internal::static_thread_entry<name##_entry>,       \
+                  nullptr, nullptr, nullptr,                              \
+                  (attr).native_prio(), (attr).native_options(),          \
+                  (attr).native_delay_ms());                              \
+  inline auto name() noexcept {                                           \
+    return zpp::thread_id(name##_native);                                 \
+  }
+
 #endif // ZPP_INCLUDE_ZPP_THREAD_HPP
@@ -8,11 +8,15 @@
 #define ZPP_INCLUDE_ZPP_THREAD_ATTR_HPP
 
 #include <zpp/thread_prio.hpp>
+#include <zpp/thread_cpu_mask.hpp>
+#include <zpp/clock.hpp>
 
 #include <zephyr/kernel.h>
 #include <zephyr/sys/__assert.h>
 
 #include <chrono>
+#include <cstdint>
+#include <limits>
 #include <utility>
 
 namespace zpp {
@@ -29,6 +33,44 @@ struct thread_start_delay {
   std::chrono::duration<T_Rep, T_Period> t;
 };
 
+#ifdef CONFIG_SCHED_DEADLINE
+
+///
+/// @brief Relative EDF deadline, used when threads have the same priority
+///
+template<class T_Rep, class T_Period>
+struct thread_deadline {
+  std::chrono::duration<T_Rep, T_Period> t;
+};
+
+namespace internal {
+
+///
+/// @brief convert a relative deadline to the cycles k_thread_deadline_set()
+///        expects
+///
+template<class T_Rep, class T_Period>
+constexpr int to_deadline_cycles(const std::chrono::duration<T_Rep, T_Period>& d) noexcept
+{
+  using namespace std::chrono;
+
+  auto ns = duration_cast<nanoseconds>(d).count();
+  if (ns <= 0) {
+    return 1;
+  }
+
+  auto cyc = k_ns_to_cyc_ceil64(static_cast<uint64_t>(ns));
+  if (cyc > static_cast<uint64_t>(std::numeric_limits<int>::max())) {
+    return std::numeric_limits<int>::max();
+  }
+
+  return cyc == 0 ? 1 : static_cast<int>(cyc);
+}
+
+} // namespace internal
+
+#endif // CONFIG_SCHED_DEADLINE
+
 ///
 /// @brief Thread creation attributes.
 ///
@@ -92,7 +134,7 @@ public:
     if (delay.t <= decltype(delay.t)::zero()) {
       m_delay = K_NO_WAIT;
     } else {
-      m_delay = to_tick(delay.t);
+      m_delay = to_timeout(delay.t);
     }
   }
 
@@ -186,6 +228,93 @@ public:
 #endif
   }
 
+#ifdef CONFIG_SCHED_CPU_MASK
+  ///
+  /// @brief Set the CPUs the thread may run on
+  ///
+  /// The thread is created suspended, the mask is applied and then the
+  /// thread is started. A mask can not be combined with a start delay,
+  /// creating a thread with both fails and the thread object does not
+  /// manage a thread.
+  ///
+  /// @param mask The CPU mask
+  ///
+  constexpr void set(thread_cpu_mask mask) noexcept
+  {
+    __ASSERT_NO_MSG(!mask.empty());
+    m_cpu_mask = mask;
+  }
+
+  ///
+  /// @brief check if a CPU mask was set
+  ///
+  /// @return true if a CPU mask was set
+  ///
+  constexpr bool has_cpu_mask() const noexcept
+  {
+    return !m_cpu_mask.empty();
+  }
+
+  ///
+  /// @brief get the CPU mask
+  ///
+  /// @return The CPU mask, empty if none was set
+  ///
+  constexpr auto cpu_mask() const noexcept
+  {
+    return m_cpu_mask;
+  }
+#endif // CONFIG_SCHED_CPU_MASK
+
+#ifdef CONFIG_SCHED_DEADLINE
+  ///
+  /// @brief Set the EDF deadline the thread gets when it is started
+  ///
+  /// The thread is created suspended, the deadline is set and then the
+  /// thread is started. A deadline can not be combined with a start delay,
+  /// creating a thread with both fails and the thread object does not
+  /// manage a thread.
+  ///
+  /// @param deadline The deadline relative to the thread start
+  ///
+  template<class T_Rep, class T_Period>
+  constexpr void
+  set(const thread_deadline<T_Rep, T_Period>& deadline) noexcept
+  {
+    m_deadline = internal::to_deadline_cycles(deadline.t);
+  }
+
+  ///
+  /// @brief check if a deadline was set
+  ///
+  /// @return true if a deadline was set
+  ///
+  constexpr bool has_deadline() const noexcept
+  {
+    return m_deadline != 0;
+  }
+
+  ///
+  /// @brief get the Zephyr native deadline value
+  ///
+  /// @return The deadline in cycles, 0 if none was set
+  ///
+  constexpr auto native_deadline() const noexcept
+  {
+    return m_deadline;
+  }
+#endif // CONFIG_SCHED_DEADLINE
+
+  ///
+  /// @brief check if the thread starts after a delay
+  ///
+  /// @return true if the thread neither starts right away nor suspended
+  ///
+  constexpr bool has_start_delay() const noexcept
+  {
+    return !K_TIMEOUT_EQ(m_delay, K_NO_WAIT) && !K_TIMEOUT_EQ(m_delay, K_FOREVER);
+  }
+
   ///
   /// @brief get the Zephyr native delay value
   ///
@@ -196,6 +325,27 @@ public:
     return m_delay;
   }
 
+  ///
+  /// @brief get the start delay in milliseconds, like K_THREAD_DEFINE
+  ///        expects it
+  ///
+  /// @return The delay in milliseconds, SYS_FOREVER_MS when the thread
+  ///         starts suspended
+  ///
+  constexpr int32_t native_delay_ms() const noexcept
+  {
+    if (K_TIMEOUT_EQ(m_delay, K_FOREVER)) {
+      return SYS_FOREVER_MS;
+    }
+
+    auto ms = k_ticks_to_ms_ceil64(static_cast<uint64_t>(m_delay.ticks));
+    if (ms > static_cast<uint64_t>(std::numeric_limits<int32_t>::max())) {
+      return std::numeric_limits<int32_t>::max();
+    }
+
+    return static_cast<int32_t>(ms);
+  }
+
   ///
   /// @brief get the Zephyr native priority value
   ///
@@ -219,6 +369,12 @@ private:
   thread_prio m_prio{ };
   uint32_t    m_options{ 0 };
   k_timeout_t m_delay{ K_NO_WAIT };
+#ifdef CONFIG_SCHED_CPU_MASK
+  thread_cpu_mask m_cpu_mask{ };
+#endif
+#ifdef CONFIG_SCHED_DEADLINE
+  int         m_deadline{ 0 };
+#endif
 };
 
 } // namespace zpp
@@ -0,0 +1,198 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_THREAD_CPU_MASK_HPP
+#define ZPP_INCLUDE_ZPP_THREAD_CPU_MASK_HPP
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef CONFIG_SCHED_CPU_MASK
+
+namespace zpp {
+
+///
+/// @brief Set of CPUs a thread is allowed to run on
+///
+class thread_cpu_mask {
+public:
+  ///
+  /// @brief The maximum number of CPUs the kernel is configured for
+  ///
+#if defined(CONFIG_MP_MAX_NUM_CPUS)
+  static constexpr size_t max_cpus = CONFIG_MP_MAX_NUM_CPUS;
+#elif defined(CONFIG_MP_NUM_CPUS)
+  static constexpr size_t max_cpus = CONFIG_MP_NUM_CPUS;
+#else
+  static constexpr size_t max_cpus = 1;
+#endif
+
+  static_assert(max_cpus > 0 && max_cpus <= 32);
+
+  ///
+  /// @brief The mask with all CPUs set
+  ///
+  static constexpr uint32_t all_bits =
+    (max_cpus == 32) ? 0xFFFFFFFFU : ((1U << max_cpus) - 1U);
+public:
+  ///
+  /// @brief Default constructor creating an empty mask
+  ///
+  constexpr thread_cpu_mask() noexcept = default;
+
+  ///
+  /// @brief Constructor creating a mask from a bit mask
+  ///
+  /// @param mask Bit @a n set means the thread may run on CPU @a n
+  ///
+  constexpr explicit thread_cpu_mask(uint32_t mask) noexcept
+    : m_mask(mask)
+  {
+    __ASSERT_NO_MSG((mask & ~all_bits) == 0);
+  }
+
+  ///
+  /// @brief Create a mask allowing all CPUs
+  ///
+  /// @return The mask allowing all CPUs
+  ///
+  static constexpr thread_cpu_mask all() noexcept
+  {
+    return thread_cpu_mask(all_bits);
+  }
+
+  ///
+  /// @brief Create a mask allowing a single CPU
+  ///
+  /// @param cpu The CPU to allow
+  ///
+  /// @return The mask allowing only @a cpu
+  ///
+  static constexpr thread_cpu_mask cpu(size_t cpu) noexcept
+  {
+    __ASSERT_NO_MSG(cpu < max_cpus);
+    return thread_cpu_mask(1U << cpu);
+  }
+
+  ///
+  /// @brief Create a mask allowing a set of CPUs checked at compile time
+  ///
+  /// @param T_Cpus The CPUs to allow
+  ///
+  /// @return The mask allowing @a T_Cpus
+  ///
+  template<size_t... T_Cpus>
+  static constexpr thread_cpu_mask of() noexcept
+  {
+    static_assert(sizeof...(T_Cpus) > 0);
+    static_assert(((T_Cpus < max_cpus) && ...),
+                  "CPU index exceeds CONFIG_MP_MAX_NUM_CPUS");
+
+    return thread_cpu_mask(((1U << T_Cpus) | ...));
+  }
+
+  ///
+  /// @brief Create the mask for worker @a index when spreading workers
+  ///        round robin over CPUs
+  ///
+  /// @param index The index of the worker
+  /// @param cpus The number of CPUs to spread over
+  ///
+  /// @return The mask allowing exactly one CPU
+  ///
+  static constexpr thread_cpu_mask
+  spread(size_t index, size_t cpus = max_cpus) noexcept
+  {
+    __ASSERT_NO_MSG(cpus > 0 && cpus <= max_cpus);
+    return cpu(index % cpus);
+  }
+
+  ///
+  /// @brief Check if a CPU is in the mask
+  ///
+  /// @param cpu The CPU to check
+  ///
+  /// @return true if the thread may run on @a cpu
+  ///
+  constexpr bool test(size_t cpu) const noexcept
+  {
+    return cpu < max_cpus && (m_mask & (1U << cpu)) != 0;
+  }
+
+  ///
+  /// @brief Check if the mask is empty
+  ///
+  /// @return true if no CPU is set
+  ///
+  constexpr bool empty() const noexcept
+  {
+    return m_mask == 0;
+  }
+
+  ///
+  /// @brief Get the mask as bits
+  ///
+  /// @return Bit @a n is set when CPU @a n is allowed
+  ///
+  constexpr uint32_t native_value() const noexcept
+  {
+    return m_mask;
+  }
+private:
+  uint32_t m_mask{ 0 };
+};
+
+///
+/// @brief Compare two CPU masks
+///
+/// @param lhs Left hand side for comparison
+/// @param rhs Right hand side for comparison
+///
+/// @return true if both masks are equal
+///
+constexpr bool operator==(thread_cpu_mask lhs, thread_cpu_mask rhs) noexcept
+{
+  return lhs.native_value() == rhs.native_value();
+}
+
+///
+/// @brief Compare two CPU masks
+///
+/// @param lhs Left hand side for comparison
+/// @param rhs Right hand side for comparison
+///
+/// @return true if both masks differ
+///
+constexpr bool operator!=(thread_cpu_mask lhs, thread_cpu_mask rhs) noexcept
+{
+  return lhs.native_value() != rhs.native_value();
+}
+
+namespace internal {
+
+inline int apply_cpu_mask(k_tid_t tid, thread_cpu_mask mask) noexcept
+{
+  auto rc = k_thread_cpu_mask_clear(tid);
+
+  for (size_t cpu = 0; rc == 0 && cpu < thread_cpu_mask::max_cpus; ++cpu) {
+    if (mask.test(cpu)) {
+      rc = k_thread_cpu_mask_enable(tid, static_cast<int>(cpu));
+    }
+  }
+
+  return rc;
+}
+
+} // namespace internal
+
+} // namespace zpp
+
+#endif // CONFIG_SCHED_CPU_MASK
+
+#endif // ZPP_INCLUDE_ZPP_THREAD_CPU_MASK_HPP
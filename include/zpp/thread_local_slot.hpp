@@ -0,0 +1,252 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_THREAD_LOCAL_SLOT_HPP
+#define ZPP_INCLUDE_ZPP_THREAD_LOCAL_SLOT_HPP
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/__assert.h>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <zpp/thread_id.hpp>
+
+namespace zpp {
+
+///
+/// @brief A value per thread, constructed the first time a thread uses it
+///
+/// Every thread that calls get() owns one entry of a fixed table, which
+/// is claimed with a single compare and swap, so using the value needs
+/// no lock. With CONFIG_THREAD_LOCAL_STORAGE each thread also caches the
+/// entry it used last, so repeated calls skip the table search.
+///
+/// Zephyr has no hook that runs when a thread exits, the entry of a
+/// thread that is done must be released with reset(), by the thread
+/// itself or by another thread after joining it. A new thread using the
+/// same TCB would otherwise find the value of the old one. Entries that
+/// are still in use are destroyed with the slot.
+///
+/// @param T_Value the type of the per thread value
+/// @param T_MaxThreads the maximum number of threads that can have a value
+///
+template<class T_Value, size_t T_MaxThreads>
+class thread_local_slot {
+  static_assert(T_MaxThreads > 0);
+  static_assert(std::is_nothrow_destructible_v<T_Value>);
+private:
+  struct entry {
+    atomic_ptr_t owner{ nullptr };
+    alignas(T_Value) std::byte storage[sizeof(T_Value)];
+
+    T_Value* value() noexcept
+    {
+      return std::launder(reinterpret_cast<T_Value*>(storage));
+    }
+  };
+public:
+  using value_type = T_Value;
+public:
+  ///
+  /// @brief default constructor creating a slot without values
+  ///
+  constexpr thread_local_slot() noexcept = default;
+
+  ///
+  /// @brief destroy the values of all threads
+  ///
+  ~thread_local_slot() noexcept
+  {
+    for (auto& e : m_entries) {
+      if (atomic_ptr_get(&e.owner) != nullptr) {
+        std::destroy_at(e.value());
+      }
+    }
+  }
+
+  ///
+  /// @brief the maximum number of threads that can have a value
+  ///
+  /// @return the maximum number of threads
+  ///
+  static constexpr size_t max_threads() noexcept
+  {
+    return T_MaxThreads;
+  }
+
+  ///
+  /// @brief get the value of the current thread, construct it if needed
+  ///
+  /// Must not be called from an ISR.
+  ///
+  /// @param args the arguments to construct the value with, only used
+  ///        when the current thread has no value yet
+  ///
+  /// @return pointer to the value or nullptr when all entries are in use
+  ///
+  template<class... T_Args>
+  [[nodiscard]] T_Value* get(T_Args&&... args) noexcept
+  {
+    static_assert(std::is_nothrow_constructible_v<T_Value, T_Args...>);
+
+    auto self = current();
+
+    auto e = lookup(self);
+    if (e != nullptr) {
+      return e->value();
+    }
+
+    for (auto& c : m_entries) {
+      if (atomic_ptr_cas(&c.owner, nullptr, self)) {
+        std::construct_at(c.value(), std::forward<T_Args>(args)...);
+        remember(&c);
+        return c.value();
+      }
+    }
+
+    return nullptr;
+  }
+
+  ///
+  /// @brief get the value of the current thread without constructing it
+  ///
+  /// Must not be called from an ISR.
+  ///
+  /// @return pointer to the value or nullptr when the thread has none
+  ///
+  [[nodiscard]] T_Value* find() noexcept
+  {
+    auto e = lookup(current());
+
+    return e != nullptr ? e->value() : nullptr;
+  }
+
+  ///
+  /// @brief destroy the value of the current thread
+  ///
+  /// Must not be called from an ISR.
+  ///
+  /// @return true if the current thread had a value
+  ///
+  bool reset() noexcept
+  {
+    auto e = lookup(current());
+    if (e == nullptr) {
+      return false;
+    }
+
+    release(e);
+
+    return true;
+  }
+
+  ///
+  /// @brief destroy the value of a thread that no longer uses it
+  ///
+  /// @param tid the thread, it must have exited or be joined
+  ///
+  /// @return true if the thread had a value
+  ///
+  bool reset(thread_id tid) noexcept
+  {
+    for (auto& e : m_entries) {
+      if (atomic_ptr_get(&e.owner) == tid.native_handle()) {
+        release(&e);
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  ///
+  /// @brief the number of threads that have a value
+  ///
+  /// @return the number of threads with a value
+  ///
+  [[nodiscard]] size_t size() const noexcept
+  {
+    size_t n{ 0 };
+
+    for (auto& e : m_entries) {
+      if (atomic_ptr_get(&e.owner) != nullptr) {
+        n++;
+      }
+    }
+
+    return n;
+  }
+private:
+  static k_tid_t current() noexcept
+  {
+    __ASSERT(!k_is_in_isr(), "thread_local_slot used from an ISR");
+
+    return k_current_get();
+  }
+
+  entry* lookup(k_tid_t self) noexcept
+  {
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+    // the owner check also catches an entry of a destroyed slot that
+    // had the same address
+    if (t_cache.slot == this
+        && atomic_ptr_get(&t_cache.e->owner) == self)
+    {
+      return t_cache.e;
+    }
+#endif
+
+    for (auto& e : m_entries) {
+      if (atomic_ptr_get(&e.owner) == self) {
+        remember(&e);
+        return &e;
+      }
+    }
+
+    return nullptr;
+  }
+
+  void remember(entry* e) noexcept
+  {
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+    t_cache.slot = this;
+    t_cache.e = e;
+#else
+    (void)e;
+#endif
+  }
+
+  void release(entry* e) noexcept
+  {
+    std::destroy_at(e->value());
+    atomic_ptr_clear(&e->owner);
+  }
+private:
+  entry m_entries[T_MaxThreads]{};
+
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+  struct cache {
+    const thread_local_slot* slot{ nullptr };
+    entry*                   e{ nullptr };
+  };
+
+  static inline thread_local cache t_cache{};
+#endif
+public:
+  thread_local_slot(const thread_local_slot&) = delete;
+  thread_local_slot(thread_local_slot&&) = delete;
+  thread_local_slot& operator=(const thread_local_slot&) = delete;
+  thread_local_slot& operator=(thread_local_slot&&) = delete;
+};
+
+} // namespace zpp
+
+#endif // ZPP_INCLUDE_ZPP_THREAD_LOCAL_SLOT_HPP
@@ -0,0 +1,208 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_THREAD_RUNTIME_STATS_HPP
+#define ZPP_INCLUDE_ZPP_THREAD_RUNTIME_STATS_HPP
+
+#include <zpp/result.hpp>
+#include <zpp/error_code.hpp>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace zpp {
+
+#ifdef CONFIG_THREAD_RUNTIME_STATS
+
+///
+/// @brief Runtime statistics of a thread, or of the whole system
+///
+/// The values are snapshots taken by k_thread_runtime_stats_get()
+/// or k_thread_runtime_stats_all_get().
+///
+class thread_runtime_stats {
+public:
+  using native_type = k_thread_runtime_stats_t;
+public:
+  ///
+  /// @brief Default constructor, all counters are zero
+  ///
+  constexpr thread_runtime_stats() noexcept = default;
+
+  ///
+  /// @brief Construct from the native Zephyr statistics
+  ///
+  /// @param s The native statistics
+  ///
+  constexpr explicit thread_runtime_stats(const native_type& s) noexcept
+    : m_stats(s)
+  {
+  }
+
+  ///
+  /// @brief Number of cycles the thread has been running
+  ///
+  /// @return the execution time in cycles
+  ///
+  constexpr uint64_t execution_cycles() const noexcept
+  {
+    return m_stats.execution_cycles;
+  }
+
+  ///
+  /// @brief Time the thread has been running
+  ///
+  /// @return the execution time
+  ///
+  std::chrono::nanoseconds execution_time() const noexcept
+  {
+    return to_ns(execution_cycles());
+  }
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
+  ///
+  /// @brief Cycles of the current, or last, scheduling window
+  ///
+  /// @return the cycles of the current window
+  ///
+  constexpr uint64_t current_cycles() const noexcept
+  {
+    return m_stats.current_cycles;
+  }
+
+  ///
+  /// @brief Cycles of the longest scheduling window
+  ///
+  /// @return the cycles of the longest window
+  ///
+  constexpr uint64_t peak_cycles() const noexcept
+  {
+    return m_stats.peak_cycles;
+  }
+
+  ///
+  /// @brief Average cycles of all scheduling windows
+  ///
+  /// @return the average cycles per window
+  ///
+  constexpr uint64_t average_cycles() const noexcept
+  {
+    return m_stats.average_cycles;
+  }
+
+  ///
+  /// @brief Duration of the longest scheduling window
+  ///
+  /// @return the longest time the thread ran without being switched out
+  ///
+  std::chrono::nanoseconds peak_time() const noexcept
+  {
+    return to_ns(peak_cycles());
+  }
+#endif // CONFIG_SCHED_THREAD_USAGE_ANALYSIS
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+  ///
+  /// @brief Cycles spent in the idle thread, only set for system stats
+  ///
+  /// @return the idle cycles
+  ///
+  constexpr uint64_t idle_cycles() const noexcept
+  {
+    return m_stats.idle_cycles;
+  }
+#endif // CONFIG_SCHED_THREAD_USAGE_ALL
+
+  ///
+  /// @brief Get the native Zephyr statistics
+  ///
+  /// @return the native statistics
+  ///
+  constexpr const native_type& native_handle() const noexcept
+  {
+    return m_stats;
+  }
+private:
+  static std::chrono::nanoseconds to_ns(uint64_t cycles) noexcept
+  {
+    return std::chrono::nanoseconds(k_cyc_to_ns_floor64(cycles));
+  }
+private:
+  native_type m_stats{};
+};
+
+#endif // CONFIG_THREAD_RUNTIME_STATS
+
+namespace internal {
+
+#ifdef CONFIG_THREAD_RUNTIME_STATS
+inline auto get_runtime_stats(k_tid_t tid) noexcept
+{
+  result<thread_runtime_stats, error_code> res;
+
+  k_thread_runtime_stats_t s{};
+  auto rc = k_thread_runtime_stats_get(tid, &s);
+  if (rc == 0) {
+    res.assign_value(thread_runtime_stats(s));
+  } else {
+    res.assign_error(to_error_code(-rc));
+  }
+
+  return res;
+}
+#endif // CONFIG_THREAD_RUNTIME_STATS
+
+inline auto get_stack_unused(k_tid_t tid) noexcept
+{
+  result<size_t, error_code> res;
+
+#if defined(CONFIG_INIT_STACKS) && defined(CONFIG_THREAD_STACK_INFO)
+  size_t unused{ 0 };
+  auto rc = k_thread_stack_space_get(tid, &unused);
+  if (rc == 0) {
+    res.assign_value(unused);
+  } else {
+    res.assign_error(to_error_code(-rc));
+  }
+#else
+  (void)tid;
+  res.assign_error(error_code::k_notsup);
+#endif
+
+  return res;
+}
+
+} // namespace internal
+
+#ifdef CONFIG_THREAD_RUNTIME_STATS
+///
+/// @brief Get the runtime statistics of all threads together
+///
+/// @return the system wide statistics, or an error code
+///
+inline auto runtime_stats_all() noexcept
+{
+  result<thread_runtime_stats, error_code> res;
+
+  k_thread_runtime_stats_t s{};
+  auto rc = k_thread_runtime_stats_all_get(&s);
+  if (rc == 0) {
+    res.assign_value(thread_runtime_stats(s));
+  } else {
+    res.assign_error(to_error_code(-rc));
+  }
+
+  return res;
+}
+#endif // CONFIG_THREAD_RUNTIME_STATS
+
+} // namespace zpp
+
+#endif // ZPP_INCLUDE_ZPP_THREAD_RUNTIME_STATS_HPP
@@ -14,7 +14,9 @@
 #include <functional>
 #include <type_traits>
 
+#include <zpp/atomic_var.hpp>
 #include <zpp/clock.hpp>
+#include <zpp/utils.hpp>
 
 namespace zpp {
 
@@ -209,6 +211,121 @@ private:
 };
 
 
+///
+/// @brief timer class that calls its expire callback from a work queue
+///
+/// The k_timer expiry function only counts the expiry and submits a
+/// work item, so the time spent in interrupt context does not depend on
+/// the callback. Expiries that happen while the work item is still
+/// pending are coalesced into one callback, the extra ones are counted
+/// as overruns.
+///
+/// The callback is called as cb(timer*, count) when it accepts the
+/// number of expiries that were coalesced, otherwise as cb(timer*).
+///
+/// The timer must not be destroyed from its own callback.
+///
+/// @param ExpireCallback Type of the expire callback
+///
+template<class T_ExpireCallback>
+class deferred_timer : public timer_base
+{
+public:
+  deferred_timer() = delete;
+
+  ///
+  /// @brief construct timer with an expire callback
+  ///
+  /// @param ecb the expire callback
+  /// @param queue the work queue that calls @a ecb, nullptr for the
+  ///        system work queue
+  ///
+  explicit deferred_timer(T_ExpireCallback ecb,
+                          struct k_work_q* queue = nullptr) noexcept
+    : timer_base()
+    , m_expire_callback(ecb)
+    , m_queue(queue)
+  {
+    k_timer_expiry_t ecb_func = [](struct k_timer* t) noexcept {
+      auto self = get_user_data(t);
+      if (self != nullptr) {
+        self->m_pending.fetch_inc();
+        if (self->m_queue != nullptr) {
+          k_work_submit_to_queue(self->m_queue, &self->m_work.work);
+        } else {
+          k_work_submit(&self->m_work.work);
+        }
+      }
+    };
+
+    m_work.self = this;
+    k_work_init(&m_work.work, &work_handler);
+
+    k_timer_init( native_handle(), ecb_func, nullptr);
+    k_timer_user_data_set( native_handle(), this);
+  }
+
+  ///
+  /// @brief Destructor that stops the timer and waits for a running
+  ///        callback to finish
+  ///
+  ~deferred_timer()
+  {
+    stop();
+
+    struct k_work_sync sync;
+    k_work_cancel_sync(&m_work.work, &sync);
+  }
+
+  ///
+  /// @brief get the number of expiries that did not get their own
+  ///        callback
+  ///
+  /// @return the total number of coalesced expiries
+  ///
+  [[nodiscard]] auto overruns() noexcept
+  {
+    return m_overruns.load();
+  }
+private:
+  struct work_item {
+    struct k_work   work;
+    deferred_timer* self;
+  };
+
+  static deferred_timer* get_user_data(struct k_timer* t) noexcept
+  {
+    return static_cast<deferred_timer*>(k_timer_user_data_get(t));
+  }
+
+  static void work_handler(struct k_work* w) noexcept
+  {
+    auto self = internal::container_of(w, &work_item::work)->self;
+
+    auto count = self->m_pending.clear();
+    if (count == 0) {
+      return;
+    }
+
+    self->m_overruns.fetch_add(count - 1);
+
+    if constexpr (std::is_invocable_v<T_ExpireCallback&, deferred_timer*,
+                                      decltype(count)>)
+    {
+      std::invoke(self->m_expire_callback, self, count);
+    } else {
+      std::invoke(self->m_expire_callback, self);
+    }
+  }
+private:
+  T_ExpireCallback  m_expire_callback;
+  struct k_work_q*  m_queue;
+  work_item         m_work{};
+  atomic_var        m_pending;
+  atomic_var        m_overruns;
+};
+
+
 ///
 /// @brief timer class with no callbacks used for syncing only
 ///
@@ -262,6 +379,22 @@ inline auto make_timer(T_ExpireCallback&& ecb, T_StopCallback&& scb) noexcept
   return timer(std::forward<T_ExpireCallback>(ecb), std::forward<T_StopCallback>(scb));
 }
 
+///
+/// @brief create deferred_timer object
+///
+/// @param ecb the expire callback
+/// @param queue the work queue that calls @a ecb, nullptr for the
+///        system work queue
+///
+/// @return deferred_timer object
+///
+template<class T_ExpireCallback>
+inline auto make_deferred_timer(T_ExpireCallback&& ecb,
+                                struct k_work_q* queue = nullptr) noexcept
+{
+  return deferred_timer(std::forward<T_ExpireCallback>(ecb), queue);
+}
+
 } // namespace zpp
 
 #endif // ZPP_INCLUDE_ZPP_TIMER_HPP
@@ -0,0 +1,345 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_TIMER_WHEEL_HPP
+#define ZPP_INCLUDE_ZPP_TIMER_WHEEL_HPP
+
+#include <zpp/clock.hpp>
+#include <zpp/timer.hpp>
+#include <zpp/intrusive_dlist.hpp>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/dlist.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace zpp {
+
+template<size_t T_Slots, size_t T_Levels>
+class timer_wheel;
+
+///
+/// @brief A software timer managed by a timer_wheel
+///
+/// Derive from this class, or embed it, to put the timer in the object
+/// it belongs to. The callback gets the entry, a derived object can be
+/// found with a static_cast.
+///
+class timer_wheel_entry {
+public:
+  ///
+  /// @brief Type of the expire callback
+  ///
+  using callback_type = void (*)(timer_wheel_entry& entry) noexcept;
+public:
+  ///
+  /// @brief create an entry
+  ///
+  /// @param cb the callback to call when the timer expires, it is called
+  ///        from the context that drives the wheel
+  ///
+  explicit timer_wheel_entry(callback_type cb) noexcept
+    : m_callback(cb)
+  {
+    __ASSERT_NO_MSG(m_callback != nullptr);
+    sys_dnode_init(&m_node);
+  }
+
+  ///
+  /// @brief check if the timer is running
+  ///
+  /// @return true if the timer is running
+  ///
+  [[nodiscard]] bool is_active() const noexcept
+  {
+    return sys_dnode_is_linked(&m_node);
+  }
+private:
+  template<size_t T_Slots, size_t T_Levels>
+  friend class timer_wheel;
+private:
+  sys_dnode_t   m_node{};
+  uint64_t      m_expires{ 0 };
+  callback_type m_callback{ nullptr };
+public:
+  timer_wheel_entry() = delete;
+  timer_wheel_entry(const timer_wheel_entry&) = delete;
+  timer_wheel_entry(timer_wheel_entry&&) = delete;
+  timer_wheel_entry& operator=(const timer_wheel_entry&) = delete;
+  timer_wheel_entry& operator=(timer_wheel_entry&&) = delete;
+};
+
+///
+/// @brief Hierarchical timer wheel for large numbers of software timers
+///
+/// All entries share one periodic k_timer. Starting, stopping and
+/// restarting an entry is O(1), independent of the number of running
+/// entries, where every k_timer is an O(n) insert in the kernel timeout
+/// list.
+///
+/// Level 0 has @a T_Slots slots of one tick, every next level has slots
+/// @a T_Slots times longer. An entry is put in the lowest level that
+/// covers its timeout and moved down a level when its slot comes up.
+/// Timeouts longer than the wheel range are parked in the last level and
+/// re-inserted until they expire.
+///
+/// The expire callbacks are called from the k_timer expiry function, so
+/// in interrupt context, with the internal lock released. A callback may
+/// start or stop any entry, including its own.
+///
+/// @param T_Slots the number of slots per level, a power of two
+/// @param T_Levels the number of levels
+///
+template<size_t T_Slots = 64, size_t T_Levels = 4>
+class timer_wheel {
+public:
+  using duration = std::chrono::nanoseconds;
+
+  static_assert(T_Slots >= 2 && (T_Slots & (T_Slots - 1)) == 0,
+                "number of slots must be a power of two");
+  static_assert(T_Levels >= 1);
+
+  ///
+  /// @brief number of bits of the tick count used per level
+  ///
+  static constexpr size_t slot_bits = __builtin_ctzll(T_Slots);
+
+  static_assert(slot_bits * T_Levels < 64);
+
+  ///
+  /// @brief the longest timeout, in ticks, that fits in the wheel
+  ///
+  static constexpr uint64_t max_ticks = (uint64_t{1} << (slot_bits * T_Levels)) - 1;
+public:
+  ///
+  /// @brief create a timer wheel and start ticking
+  ///
+  /// @param tick the resolution of the wheel
+  ///
+  template<class T_Rep, class T_Period>
+  explicit timer_wheel(const std::chrono::duration<T_Rep, T_Period>& tick) noexcept
+    : m_tick(std::chrono::duration_cast<duration>(tick))
+    , m_timer(tick_callback{ this })
+  {
+    __ASSERT_NO_MSG(m_tick > duration::zero());
+    m_timer.start(m_tick, m_tick);
+  }
+
+  ///
+  /// @brief start, or restart, an entry
+  ///
+  /// @param entry the entry to start
+  /// @param timeout the time until the entry expires, rounded up to
+  ///        whole ticks
+  ///
+  template<class T_Rep, class T_Period>
+  void start(timer_wheel_entry& entry,
+             const std::chrono::duration<T_Rep, T_Period>& timeout) noexcept
+  {
+    auto t = std::chrono::duration_cast<duration>(timeout);
+    uint64_t ticks = t <= duration::zero() ? 1 :
+      static_cast<uint64_t>((t.count() + m_tick.count() - 1) / m_tick.count());
+
+    start_ticks(entry, ticks);
+  }
+
+  ///
+  /// @brief start, or restart, an entry
+  ///
+  /// @param entry the entry to start
+  /// @param ticks the number of ticks until the entry expires
+  ///
+  void start_ticks(timer_wheel_entry& entry, uint64_t ticks) noexcept
+  {
+    auto key = k_spin_lock(&m_lock);
+
+    if (entry.is_active()) {
+      sys_dlist_remove(&entry.m_node);
+    }
+
+    entry.m_expires = m_now + (ticks == 0 ? 1 : ticks);
+    insert(entry);
+
+    k_spin_unlock(&m_lock, key);
+  }
+
+  ///
+  /// @brief stop an entry
+  ///
+  /// @param entry the entry to stop
+  ///
+  /// @return true if the entry was running
+  ///
+  bool stop(timer_wheel_entry& entry) noexcept
+  {
+    bool was_active = false;
+
+    auto key = k_spin_lock(&m_lock);
+
+    if (entry.is_active()) {
+      sys_dlist_remove(&entry.m_node);
+      was_active = true;
+    }
+
+    k_spin_unlock(&m_lock, key);
+
+    return was_active;
+  }
+
+  ///
+  /// @brief get the time until an entry expires
+  ///
+  /// @param entry the entry
+  ///
+  /// @return the remaining time, zero when the entry is not running
+  ///
+  [[nodiscard]] duration remaining(const timer_wheel_entry& entry) noexcept
+  {
+    duration res{ 0 };
+
+    auto key = k_spin_lock(&m_lock);
+
+    if (entry.is_active()) {
+      res = m_tick * static_cast<int64_t>(entry.m_expires - m_now);
+    }
+
+    k_spin_unlock(&m_lock, key);
+
+    return res;
+  }
+
+  ///
+  /// @brief advance the wheel one tick and call the expired callbacks
+  ///
+  /// This is called by the internal timer every tick.
+  ///
+  void tick() noexcept
+  {
+    intrusive_dlist<timer_wheel_entry, &timer_wheel_entry::m_node> expired;
+
+    auto key = k_spin_lock(&m_lock);
+
+    m_now++;
+
+    // move the entries of higher level slots that come up down a level
+    for (size_t level = 1; level < T_Levels; ++level) {
+      if ((m_now & ((uint64_t{1} << (slot_bits * level)) - 1)) != 0) {
+        break;
+      }
+
+      auto& s = slot(level, slot_index(m_now, level));
+      intrusive_dlist<timer_wheel_entry, &timer_wheel_entry::m_node> moving;
+      moving.splice(s);
+
+      while (auto e = moving.pop_front()) {
+        if (e->m_expires <= m_now) {
+          expired.push_back(*e);
+        } else {
+          insert(*e);
+        }
+      }
+    }
+
+    expired.splice(slot(0, slot_index(m_now, 0)));
+
+    // the lock is released while calling a callback, stop() can still
+    // remove entries from the expired list while that happens
+    while (auto e = expired.pop_front()) {
+      auto cb = e->m_callback;
+      k_spin_unlock(&m_lock, key);
+      cb(*e);
+      key = k_spin_lock(&m_lock);
+    }
+
+    k_spin_unlock(&m_lock, key);
+  }
+
+  ///
+  /// @brief get the current tick count
+  ///
+  /// @return the number of ticks since the wheel was created
+  ///
+  [[nodiscard]] uint64_t now() noexcept
+  {
+    auto key = k_spin_lock(&m_lock);
+    auto res = m_now;
+    k_spin_unlock(&m_lock, key);
+    return res;
+  }
+
+  ///
+  /// @brief get the tick period
+  ///
+  /// @return the duration of one tick
+  ///
+  [[nodiscard]] duration tick_period() const noexcept
+  {
+    return m_tick;
+  }
+private:
+  using slot_list = intrusive_dlist<timer_wheel_entry, &timer_wheel_entry::m_node>;
+
+  struct tick_callback {
+    timer_wheel* self;
+
+    template<class T_Timer>
+    void operator()(T_Timer*) noexcept
+    {
+      self->tick();
+    }
+  };
+
+  static constexpr size_t slot_index(uint64_t t, size_t level) noexcept
+  {
+    return static_cast<size_t>((t >> (slot_bits * level)) & (T_Slots - 1));
+  }
+
+  slot_list& slot(size_t level, size_t index) noexcept
+  {
+    return m_slots[level * T_Slots + index];
+  }
+
+  // must be called with m_lock held, entry.m_expires > m_now
+  void insert(timer_wheel_entry& entry) noexcept
+  {
+    uint64_t delta = entry.m_expires - m_now;
+    uint64_t expires = entry.m_expires;
+
+    if (delta > max_ticks) {
+      delta = max_ticks;
+      expires = m_now + max_ticks;
+    }
+
+    size_t level = 0;
+    while (level + 1 < T_Levels
+           && delta >= (uint64_t{1} << (slot_bits * (level + 1))))
+    {
+      level++;
+    }
+
+    slot(level, slot_index(expires, level)).push_back(entry);
+  }
+private:
+  struct k_spinlock                         m_lock{};
+  uint64_t                                  m_now{ 0 };
+  duration                                  m_tick;
+  std::array<slot_list, T_Slots * T_Levels> m_slots{};
+  basic_timer<tick_callback>                m_timer;
+public:
+  timer_wheel() = delete;
+  timer_wheel(const timer_wheel&) = delete;
+  timer_wheel(timer_wheel&&) = delete;
+  timer_wheel& operator=(const timer_wheel&) = delete;
+  timer_wheel& operator=(timer_wheel&&) = delete;
+};
+
+} // namespace zpp
+
+#endif // ZPP_INCLUDE_ZPP_TIMER_WHEEL_HPP
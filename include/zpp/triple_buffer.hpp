@@ -0,0 +1,145 @@
+//
+// Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef ZPP_INCLUDE_ZPP_TRIPLE_BUFFER_HPP
+#define ZPP_INCLUDE_ZPP_TRIPLE_BUFFER_HPP
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+
+#include <cstddef>
+#include <type_traits>
+
+#include <zpp/atomic_var.hpp>
+
+namespace zpp {
+
+///
+/// @brief Hand the latest value from one writer to one reader
+///
+/// The writer fills the back buffer in place and publishes it, the
+/// reader takes the latest published buffer as its front buffer. The
+/// third buffer sits in the middle, and publishing or taking a buffer
+/// is one atomic exchange of the middle buffer index, so neither side
+/// ever blocks or copies a value. A value published while the reader
+/// did not look is replaced by the next one.
+///
+/// There must be one writer thread and one reader thread.
+///
+/// @param T_Value the value type
+///
+template<class T_Value>
+class triple_buffer {
+  static_assert(std::is_nothrow_destructible_v<T_Value>);
+private:
+  // the index of the middle buffer, with the dirty bit set when the
+  // writer published it and the reader did not take it yet
+  static constexpr atomic_val_t index_mask = 0x3;
+  static constexpr atomic_val_t dirty = 0x4;
+public:
+  using value_type = T_Value;
+public:
+  ///
+  /// @brief create a triple buffer with default constructed values
+  ///
+  triple_buffer() noexcept
+    : m_middle(1)
+  {
+    static_assert(std::is_nothrow_default_constructible_v<T_Value>);
+  }
+
+  ///
+  /// @brief create a triple buffer with all values copied from @a v
+  ///
+  /// @param v the initial value
+  ///
+  explicit triple_buffer(const T_Value& v) noexcept
+    : m_buffers{ v, v, v }
+    , m_middle(1)
+  {
+    static_assert(std::is_nothrow_copy_constructible_v<T_Value>);
+  }
+
+  ///
+  /// @brief the buffer the writer fills
+  ///
+  /// Only the writer may use it, it changes with every publish().
+  ///
+  /// @return reference to the back buffer
+  ///
+  [[nodiscard]] T_Value& write_buffer() noexcept
+  {
+    return m_buffers[m_back];
+  }
+
+  ///
+  /// @brief publish the back buffer as the latest value
+  ///
+  /// The writer gets the previous middle buffer as its new back buffer,
+  /// its content is stale and must be filled again.
+  ///
+  void publish() noexcept
+  {
+    auto old = m_middle.store(m_back | dirty);
+    m_back = old & index_mask;
+  }
+
+  ///
+  /// @brief check if the writer published a value the reader did not
+  ///        take yet
+  ///
+  /// @return true if update() will get a new value
+  ///
+  [[nodiscard]] bool has_update() const noexcept
+  {
+    return (m_middle.load() & dirty) != 0;
+  }
+
+  ///
+  /// @brief take the latest published value as the front buffer
+  ///
+  /// @return true if there was a new value, false if the front buffer
+  ///         did not change
+  ///
+  bool update() noexcept
+  {
+    if (!has_update()) {
+      return false;
+    }
+
+    auto old = m_middle.store(m_front);
+    m_front = old & index_mask;
+
+    return true;
+  }
+
+  ///
+  /// @brief the buffer the reader reads
+  ///
+  /// Only the reader may use it, it changes with every update() that
+  /// returns true.
+  ///
+  /// @return reference to the front buffer
+  ///
+  [[nodiscard]] const T_Value& read_buffer() const noexcept
+  {
+    return m_buffers[m_front];
+  }
+private:
+  T_Value       m_buffers[3]{};
+  atomic_var    m_middle;
+  atomic_val_t  m_back{ 0 };
+  atomic_val_t  m_front{ 2 };
+public:
+  triple_buffer(const triple_buffer&) = delete;
+  triple_buffer(triple_buffer&&) = delete;
+  triple_buffer& operator=(const triple_buffer&) = delete;
+  triple_buffer& operator=(triple_buffer&&) = delete;
+};
+
+} // namespace zpp
+
+#endif // ZPP_INCLUDE_ZPP_TRIPLE_BUFFER_HPP
@@ -7,7 +7,10 @@
 #ifndef ZPP_INCLUDE_ZPP_UTILS_HPP
 #define ZPP_INCLUDE_ZPP_UTILS_HPP
 
+#include <bit>
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
 
 namespace zpp {
 
@@ -123,6 +126,52 @@ consteval bool is_multiple_of(uint32_t value, uint32_t base)
   }
 }
 
+namespace internal {
+
+///
+/// @brief get the offset of a member in an object
+///
+/// @param member pointer to the member
+///
+/// @return the offset in bytes of @a member in @a T_Object
+///
+#if defined(__GNUC__) || defined(__clang__)
+template<class T_Object, class T_Member>
+inline std::ptrdiff_t member_offset(T_Member T_Object::* member) noexcept
+{
+  // GCC and Clang use the Itanium C++ ABI where a pointer to a data
+  // member holds the offset of the member, so no object is needed and
+  // the offset folds to a constant when the member is known
+  static_assert(sizeof(member) == sizeof(std::ptrdiff_t),
+                "pointer to member has an unexpected size");
+
+  return std::bit_cast<std::ptrdiff_t>(member);
+}
+#else
+#error "member_offset() needs the Itanium C++ ABI of GCC or Clang"
+#endif
+
+///
+/// @brief get the object that contains a member
+///
+/// @param ptr pointer to the member of an object
+/// @param member pointer to the member
+///
+/// @return the object containing @a ptr, nullptr if @a ptr is nullptr
+///
+template<class T_Object, class T_Member>
+inline T_Object* container_of(T_Member* ptr, T_Member T_Object::* member) noexcept
+{
+  if (ptr == nullptr) {
+    return nullptr;
+  }
+
+  return reinterpret_cast<T_Object*>(
+    reinterpret_cast<char*>(ptr) - member_offset(member));
+}
+
+} // namespace internal
+
 } // namespace zpp
 
 #endif // ZPP_INCLUDE_ZPP_UTILS_HPP
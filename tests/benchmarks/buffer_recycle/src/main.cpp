@@ -0,0 +1,134 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+//
+// Buffer recycling benchmark
+//
+// A pool of buffers, together larger than the data cache, is recycled
+// through a fifo, a lifo and a stack. Every iteration takes a buffer,
+// writes all of it and releases it again. The fifo hands out the buffer
+// released longest ago, so every iteration touches a cold buffer, the
+// lifo and stack hand out the buffer just released which is still in
+// the cache.
+//
+// Output lines have the form:
+//   BENCH,buffer_recycle,<container>,<iterations>,<cycles>,<ns/iteration>
+//
+
+#include <zephyr/kernel.h>
+
+#include <zpp/fifo.hpp>
+#include <zpp/lifo.hpp>
+#include <zpp/stack.hpp>
+#include <zpp/fmt.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+
+constexpr size_t buffer_size = 1024;
+constexpr size_t buffer_count = 128;
+constexpr uint32_t iterations = 4096;
+
+struct buffer {
+  void* fifo_reserved{};
+  std::array<uint8_t, buffer_size> data{};
+};
+
+std::array<buffer, buffer_count> g_buffers;
+
+zpp::fifo<buffer> g_fifo;
+zpp::lifo<buffer> g_lifo;
+zpp::stack<buffer_count, buffer*> g_stack;
+
+void use(buffer* b, uint32_t i) noexcept
+{
+  memset(b->data.data(), static_cast<int>(i), b->data.size());
+  // keep the compiler from dropping the writes
+  __asm__ volatile("" : : "r"(b->data.data()) : "memory");
+}
+
+void report(const char* name, uint32_t cycles) noexcept
+{
+  auto ns = k_cyc_to_ns_floor64(cycles);
+  zpp::print("BENCH,buffer_recycle,{},{},{},{}\n",
+             name, iterations, cycles,
+             static_cast<uint32_t>(ns / iterations));
+}
+
+void bench_fifo() noexcept
+{
+  for (auto& b: g_buffers) {
+    g_fifo.push_back(&b);
+  }
+
+  auto start = k_cycle_get_32();
+  for (uint32_t i = 0; i < iterations; ++i) {
+    auto b = g_fifo.try_pop_front();
+    use(b, i);
+    g_fifo.push_back(b);
+  }
+  report("fifo", k_cycle_get_32() - start);
+
+  while (g_fifo.try_pop_front() != nullptr) {
+  }
+}
+
+void bench_lifo() noexcept
+{
+  for (auto& b: g_buffers) {
+    g_lifo.push(&b);
+  }
+
+  auto start = k_cycle_get_32();
+  for (uint32_t i = 0; i < iterations; ++i) {
+    auto b = g_lifo.try_pop();
+    use(b, i);
+    g_lifo.push(b);
+  }
+  report("lifo", k_cycle_get_32() - start);
+
+  while (g_lifo.try_pop() != nullptr) {
+  }
+}
+
+void bench_stack() noexcept
+{
+  for (auto& b: g_buffers) {
+    (void)g_stack.push(&b);
+  }
+
+  auto start = k_cycle_get_32();
+  for (uint32_t i = 0; i < iterations; ++i) {
+    auto b = g_stack.try_pop().value();
+    use(b, i);
+    (void)g_stack.push(b);
+  }
+  report("stack", k_cycle_get_32() - start);
+
+  while (g_stack.try_pop()) {
+  }
+}
+
+} // namespace
+
+int main(void)
+{
+  zpp::print("BENCH,buffer_recycle,pool,{},{}\n", buffer_count, buffer_size);
+
+  // warm up the code paths once, then measure
+  for (int run = 0; run < 2; ++run) {
+    bench_fifo();
+    bench_lifo();
+    bench_stack();
+  }
+
+  zpp::print("BENCH,buffer_recycle,done\n");
+
+  return 0;
+}
@@ -0,0 +1,462 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+//
+// Primitive latency benchmark
+//
+// Every zpp wrapper is measured next to the same sequence of direct
+// Zephyr C calls, so the difference between the two lines is the cost
+// of the wrapper.
+//
+// The blocking primitives are measured with a ping-pong between main()
+// and a partner thread of the same priority, one iteration is a round
+// trip with two hand-offs. The mutexes and the timer are measured
+// without contention, one iteration is a lock/unlock or start/stop pair.
+//
+// Output lines have the form:
+//   BENCH,primitives,<primitive>,<zpp|c>,<iterations>,<cycles>,<ns/iteration>
+//
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+
+#include <zpp/condition_variable.hpp>
+#include <zpp/fifo.hpp>
+#include <zpp/fmt.hpp>
+#include <zpp/futex.hpp>
+#include <zpp/mutex.hpp>
+#include <zpp/poll.hpp>
+#include <zpp/sem.hpp>
+#include <zpp/sys_mutex.hpp>
+#include <zpp/thread.hpp>
+#include <zpp/timer.hpp>
+
+#include <cstdint>
+
+namespace {
+
+constexpr uint32_t iterations = 2000;
+
+#if defined(CONFIG_MP_MAX_NUM_CPUS)
+constexpr int num_cpus = CONFIG_MP_MAX_NUM_CPUS;
+#elif defined(CONFIG_MP_NUM_CPUS)
+constexpr int num_cpus = CONFIG_MP_NUM_CPUS;
+#else
+constexpr int num_cpus = 1;
+#endif
+
+ZPP_THREAD_STACK_DEFINE(g_partner_stack, 2048);
+zpp::thread_data g_partner_tcb;
+
+void report(const char* primitive, const char* api, uint32_t cycles) noexcept
+{
+  auto ns = k_cyc_to_ns_floor64(cycles);
+  zpp::print("BENCH,primitives,{},{},{},{},{}\n",
+             primitive, api, iterations, cycles,
+             static_cast<uint32_t>(ns / iterations));
+}
+
+// run op iterations times in the calling thread
+template<class T_Op>
+void measure(const char* primitive, const char* api, T_Op op) noexcept
+{
+  auto start = k_cycle_get_32();
+  for (uint32_t i = 0; i < iterations; ++i) {
+    op();
+  }
+  report(primitive, api, k_cycle_get_32() - start);
+}
+
+// run partner in a second thread while ping is run iterations times
+template<class T_Ping>
+void ping_pong(const char* primitive, const char* api,
+               void (*partner)() noexcept, T_Ping ping) noexcept
+{
+  using namespace zpp;
+
+  const thread_attr attr(
+        this_thread::get_priority(),
+        thread_inherit_perms::no,
+        thread_essential::no,
+        thread_suspend::no
+      );
+
+  auto t = thread(g_partner_tcb, g_partner_stack(), attr, partner);
+
+  auto start = k_cycle_get_32();
+  for (uint32_t i = 0; i < iterations; ++i) {
+    ping();
+  }
+  auto cycles = k_cycle_get_32() - start;
+
+  auto rc = t.join();
+  __ASSERT_NO_MSG(rc);
+  (void)rc;
+
+  report(primitive, api, cycles);
+}
+
+//
+// sem
+//
+zpp::sem g_ping_sem(0, 1);
+zpp::sem g_pong_sem(0, 1);
+
+K_SEM_DEFINE(g_c_ping_sem, 0, 1);
+K_SEM_DEFINE(g_c_pong_sem, 0, 1);
+
+void bench_sem() noexcept
+{
+  ping_pong("sem", "zpp",
+    []() noexcept {
+      for (uint32_t i = 0; i < iterations; ++i) {
+        (void)g_ping_sem.take();
+        g_pong_sem.give();
+      }
+    },
+    []() noexcept {
+      g_ping_sem.give();
+      (void)g_pong_sem.take();
+    });
+
+  ping_pong("sem", "c",
+    []() noexcept {
+      for (uint32_t i = 0; i < iterations; ++i) {
+        k_sem_take(&g_c_ping_sem, K_FOREVER);
+        k_sem_give(&g_c_pong_sem);
+      }
+    },
+    []() noexcept {
+      k_sem_give(&g_c_ping_sem);
+      k_sem_take(&g_c_pong_sem, K_FOREVER);
+    });
+}
+
+//
+// mutex
+//
+zpp::mutex g_mutex;
+
+K_MUTEX_DEFINE(g_c_mutex);
+
+void bench_mutex() noexcept
+{
+  measure("mutex", "zpp",
+    []() noexcept {
+      (void)g_mutex.lock();
+      (void)g_mutex.unlock();
+    });
+
+  measure("mutex", "c",
+    []() noexcept {
+      k_mutex_lock(&g_c_mutex, K_FOREVER);
+      k_mutex_unlock(&g_c_mutex);
+    });
+}
+
+#ifdef CONFIG_USERSPACE
+
+//
+// sys_mutex
+//
+zpp::sys_mutex g_sys_mutex;
+
+SYS_MUTEX_DEFINE(g_c_sys_mutex);
+
+void bench_sys_mutex() noexcept
+{
+  measure("sys_mutex", "zpp",
+    []() noexcept {
+      (void)g_sys_mutex.lock();
+      (void)g_sys_mutex.unlock();
+    });
+
+  measure("sys_mutex", "c",
+    []() noexcept {
+      sys_mutex_lock(&g_c_sys_mutex, K_FOREVER);
+      sys_mutex_unlock(&g_c_sys_mutex);
+    });
+}
+
+//
+// futex, every side counts its futex up and waits for the other one
+//
+zpp::futex g_ping_futex;
+zpp::futex g_pong_futex;
+
+struct k_futex g_c_ping_futex;
+struct k_futex g_c_pong_futex;
+
+void futex_wait_for(zpp::futex& f, atomic_val_t target) noexcept
+{
+  for (;;) {
+    auto v = atomic_get(&f.native_handle()->val);
+    if (v == target) {
+      return;
+    }
+    (void)f.wait(v);
+  }
+}
+
+void futex_wait_for(struct k_futex* f, atomic_val_t target) noexcept
+{
+  for (;;) {
+    auto v = atomic_get(&f->val);
+    if (v == target) {
+      return;
+    }
+    k_futex_wait(f, v, K_FOREVER);
+  }
+}
+
+void bench_futex() noexcept
+{
+  static atomic_val_t s_count;
+
+  atomic_clear(&g_ping_futex.native_handle()->val);
+  atomic_clear(&g_pong_futex.native_handle()->val);
+  s_count = 0;
+
+  ping_pong("futex", "zpp",
+    []() noexcept {
+      for (uint32_t i = 1; i <= iterations; ++i) {
+        futex_wait_for(g_ping_futex, i);
+        atomic_inc(&g_pong_futex.native_handle()->val);
+        g_pong_futex.wake_one();
+      }
+    },
+    []() noexcept {
+      s_count++;
+      atomic_inc(&g_ping_futex.native_handle()->val);
+      g_ping_futex.wake_one();
+      futex_wait_for(g_pong_futex, s_count);
+    });
+
+  atomic_clear(&g_c_ping_futex.val);
+  atomic_clear(&g_c_pong_futex.val);
+  s_count = 0;
+
+  ping_pong("futex", "c",
+    []() noexcept {
+      for (uint32_t i = 1; i <= iterations; ++i) {
+        futex_wait_for(&g_c_ping_futex, i);
+        atomic_inc(&g_c_pong_futex.val);
+        k_futex_wake(&g_c_pong_futex, false);
+      }
+    },
+    []() noexcept {
+      s_count++;
+      atomic_inc(&g_c_ping_futex.val);
+      k_futex_wake(&g_c_ping_futex, false);
+      futex_wait_for(&g_c_pong_futex, s_count);
+    });
+}
+
+#endif // CONFIG_USERSPACE
+
+//
+// condition_variable, the turn says who may run
+//
+zpp::mutex g_cv_mutex;
+zpp::condition_variable g_cv;
+
+K_MUTEX_DEFINE(g_c_cv_mutex);
+K_CONDVAR_DEFINE(g_c_cv);
+
+bool g_partner_turn = false;
+
+void bench_condition_variable() noexcept
+{
+  g_partner_turn = false;
+
+  ping_pong("condition_variable", "zpp",
+    []() noexcept {
+      (void)g_cv_mutex.lock();
+      for (uint32_t i = 0; i < iterations; ++i) {
+        (void)g_cv.wait(g_cv_mutex, []{ return g_partner_turn; });
+        g_partner_turn = false;
+        (void)g_cv.notify_one();
+      }
+      (void)g_cv_mutex.unlock();
+    },
+    []() noexcept {
+      (void)g_cv_mutex.lock();
+      g_partner_turn = true;
+      (void)g_cv.notify_one();
+      (void)g_cv.wait(g_cv_mutex, []{ return !g_partner_turn; });
+      (void)g_cv_mutex.unlock();
+    });
+
+  g_partner_turn = false;
+
+  ping_pong("condition_variable", "c",
+    []() noexcept {
+      k_mutex_lock(&g_c_cv_mutex, K_FOREVER);
+      for (uint32_t i = 0; i < iterations; ++i) {
+        while (!g_partner_turn) {
+          k_condvar_wait(&g_c_cv, &g_c_cv_mutex, K_FOREVER);
+        }
+        g_partner_turn = false;
+        k_condvar_signal(&g_c_cv);
+      }
+      k_mutex_unlock(&g_c_cv_mutex);
+    },
+    []() noexcept {
+      k_mutex_lock(&g_c_cv_mutex, K_FOREVER);
+      g_partner_turn = true;
+      k_condvar_signal(&g_c_cv);
+      while (g_partner_turn) {
+        k_condvar_wait(&g_c_cv, &g_c_cv_mutex, K_FOREVER);
+      }
+      k_mutex_unlock(&g_c_cv_mutex);
+    });
+}
+
+//
+// fifo, one item is passed back and forth
+//
+struct item {
+  void* fifo_reserved{};
+};
+
+item g_item;
+
+zpp::fifo<item> g_ping_fifo;
+zpp::fifo<item> g_pong_fifo;
+
+K_FIFO_DEFINE(g_c_ping_fifo);
+K_FIFO_DEFINE(g_c_pong_fifo);
+
+void bench_fifo() noexcept
+{
+  ping_pong("fifo", "zpp",
+    []() noexcept {
+      for (uint32_t i = 0; i < iterations; ++i) {
+        g_pong_fifo.push_back(g_ping_fifo.pop_front());
+      }
+    },
+    []() noexcept {
+      g_ping_fifo.push_back(&g_item);
+      (void)g_pong_fifo.pop_front();
+    });
+
+  ping_pong("fifo", "c",
+    []() noexcept {
+      for (uint32_t i = 0; i < iterations; ++i) {
+        k_fifo_put(&g_c_pong_fifo, k_fifo_get(&g_c_ping_fifo, K_FOREVER));
+      }
+    },
+    []() noexcept {
+      k_fifo_put(&g_c_ping_fifo, &g_item);
+      (void)k_fifo_get(&g_c_pong_fifo, K_FOREVER);
+    });
+}
+
+//
+// poll_event_set, every side polls for its semaphore to become available
+//
+// Semaphores are used instead of poll signals because a poll signal
+// that is raised before the other side polls is reset by the poll.
+//
+zpp::sem g_poll_ping_sem(0, 1);
+zpp::sem g_poll_pong_sem(0, 1);
+
+K_SEM_DEFINE(g_c_poll_ping_sem, 0, 1);
+K_SEM_DEFINE(g_c_poll_pong_sem, 0, 1);
+
+void c_poll_take(struct k_sem* s) noexcept
+{
+  struct k_poll_event ev;
+  k_poll_event_init(&ev, K_POLL_TYPE_SEM_AVAILABLE,
+                    K_POLL_MODE_NOTIFY_ONLY, s);
+
+  k_poll(&ev, 1, K_FOREVER);
+  k_sem_take(s, K_NO_WAIT);
+}
+
+void bench_poll() noexcept
+{
+  ping_pong("poll_event_set", "zpp",
+    []() noexcept {
+      zpp::poll_event_set events{ g_poll_ping_sem };
+
+      for (uint32_t i = 0; i < iterations; ++i) {
+        (void)events.poll();
+        (void)g_poll_ping_sem.try_take();
+        g_poll_pong_sem.give();
+      }
+    },
+    []() noexcept {
+      static zpp::poll_event_set s_events{ g_poll_pong_sem };
+
+      g_poll_ping_sem.give();
+      (void)s_events.poll();
+      (void)g_poll_pong_sem.try_take();
+    });
+
+  ping_pong("poll_event_set", "c",
+    []() noexcept {
+      for (uint32_t i = 0; i < iterations; ++i) {
+        c_poll_take(&g_c_poll_ping_sem);
+        k_sem_give(&g_c_poll_pong_sem);
+      }
+    },
+    []() noexcept {
+      k_sem_give(&g_c_poll_ping_sem);
+      c_poll_take(&g_c_poll_pong_sem);
+    });
+}
+
+//
+// timer
+//
+zpp::sync_timer g_timer;
+
+K_TIMER_DEFINE(g_c_timer, nullptr, nullptr);
+
+void bench_timer() noexcept
+{
+  using namespace std::chrono;
+
+  measure("timer", "zpp",
+    []() noexcept {
+      g_timer.start(1s);
+      g_timer.stop();
+    });
+
+  measure("timer", "c",
+    []() noexcept {
+      k_timer_start(&g_c_timer, K_SECONDS(1), K_NO_WAIT);
+      k_timer_stop(&g_c_timer);
+    });
+}
+
+} // namespace
+
+int main(void)
+{
+  zpp::print("BENCH,primitives,config,{},{}\n",
+             num_cpus, sys_clock_hw_cycles_per_sec());
+
+  // the first run warms up the caches and code paths, the second is
+  // the one to look at
+  for (int run = 0; run < 2; ++run) {
+    bench_sem();
+    bench_mutex();
+#ifdef CONFIG_USERSPACE
+    bench_sys_mutex();
+    bench_futex();
+#endif
+    bench_condition_variable();
+    bench_fifo();
+    bench_poll();
+    bench_timer();
+  }
+
+  zpp::print("BENCH,primitives,done\n");
+
+  return 0;
+}
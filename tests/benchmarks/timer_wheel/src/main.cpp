@@ -0,0 +1,117 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+//
+// Timer wheel benchmark
+//
+// Starts, restarts and stops a large number of timers, once as
+// timer_wheel entries and once as k_timers. Every k_timer start is an
+// insert in the sorted kernel timeout list, so its cost grows with the
+// number of running timers, a timer wheel start is constant time.
+//
+// Output lines have the form:
+//   BENCH,timer_wheel,<impl>,<operation>,<timers>,<cycles>,<ns/timer>
+//
+
+#include <zephyr/kernel.h>
+
+#include <zpp/timer_wheel.hpp>
+#include <zpp/fmt.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace {
+
+constexpr size_t timer_count = 10000;
+
+struct connection : zpp::timer_wheel_entry {
+  connection() noexcept
+    : zpp::timer_wheel_entry([](zpp::timer_wheel_entry&) noexcept {})
+  {
+  }
+};
+
+std::array<connection, timer_count> g_connections;
+std::array<struct k_timer, timer_count> g_timers;
+
+zpp::timer_wheel<64, 4> g_wheel(std::chrono::milliseconds(1));
+
+// spread the timeouts over 1 to 10 seconds, like retransmit timers of
+// connections started at different times
+uint32_t timeout_ms(size_t i) noexcept
+{
+  return 1000 + static_cast<uint32_t>((i * 7919) % 9000);
+}
+
+void report(const char* impl, const char* op, uint32_t cycles) noexcept
+{
+  auto ns = k_cyc_to_ns_floor64(cycles);
+  zpp::print("BENCH,timer_wheel,{},{},{},{},{}\n",
+             impl, op, timer_count, cycles,
+             static_cast<uint32_t>(ns / timer_count));
+}
+
+void bench_wheel() noexcept
+{
+  using namespace std::chrono;
+
+  auto start = k_cycle_get_32();
+  for (size_t i = 0; i < timer_count; ++i) {
+    g_wheel.start(g_connections[i], milliseconds(timeout_ms(i)));
+  }
+  report("wheel", "start", k_cycle_get_32() - start);
+
+  start = k_cycle_get_32();
+  for (size_t i = 0; i < timer_count; ++i) {
+    g_wheel.start(g_connections[i], milliseconds(timeout_ms(i + 1)));
+  }
+  report("wheel", "restart", k_cycle_get_32() - start);
+
+  start = k_cycle_get_32();
+  for (auto& c: g_connections) {
+    g_wheel.stop(c);
+  }
+  report("wheel", "stop", k_cycle_get_32() - start);
+}
+
+void bench_k_timer() noexcept
+{
+  for (auto& t: g_timers) {
+    k_timer_init(&t, nullptr, nullptr);
+  }
+
+  auto start = k_cycle_get_32();
+  for (size_t i = 0; i < timer_count; ++i) {
+    k_timer_start(&g_timers[i], K_MSEC(timeout_ms(i)), K_NO_WAIT);
+  }
+  report("k_timer", "start", k_cycle_get_32() - start);
+
+  start = k_cycle_get_32();
+  for (size_t i = 0; i < timer_count; ++i) {
+    k_timer_start(&g_timers[i], K_MSEC(timeout_ms(i + 1)), K_NO_WAIT);
+  }
+  report("k_timer", "restart", k_cycle_get_32() - start);
+
+  start = k_cycle_get_32();
+  for (auto& t: g_timers) {
+    k_timer_stop(&t);
+  }
+  report("k_timer", "stop", k_cycle_get_32() - start);
+}
+
+} // namespace
+
+int main(void)
+{
+  bench_wheel();
+  bench_k_timer();
+
+  zpp::print("BENCH,timer_wheel,done\n");
+
+  return 0;
+}
@@ -0,0 +1,267 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+//
+// Wakeup latency and context switch benchmark
+//
+// main() wakes a second thread through a sem, a futex or a poll_signal
+// and the woken thread records the time from the wake call until it
+// runs. This is repeated for a set of priority combinations, so the
+// numbers show what a priority choice costs:
+//
+//  - a higher priority thread, cooperative or preemptive, runs at once
+//  - an equal or lower priority thread, or any thread woken by a
+//    cooperative thread, only runs once the waker blocks
+//
+// The waker sleeps one tick before every wake so the woken thread is
+// always blocked when it is woken.
+//
+// Next to that the cost of a context switch between two threads of the
+// same priority is measured with k_yield. On SMP the two threads can run
+// on different CPUs, so there the number is the cost of a yield.
+//
+// Output lines have the form:
+//   BENCH,wakeup_latency,<path>,<priorities>,<samples>,<min>,<avg>,<p99>,<max>
+//   BENCH,wakeup_latency,switch,<coop|preempt>,<switches>,<ns/switch>
+// with all times in nanoseconds.
+//
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+
+#include <zpp/clock.hpp>
+#include <zpp/fmt.hpp>
+#include <zpp/futex.hpp>
+#include <zpp/latency_histogram.hpp>
+#include <zpp/poll.hpp>
+#include <zpp/sem.hpp>
+#include <zpp/thread.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace {
+
+constexpr uint32_t samples = 1000;
+constexpr uint32_t yields = 10000;
+
+ZPP_THREAD_STACK_DEFINE(g_wakee_stack, 2048);
+zpp::thread_data g_wakee_tcb;
+
+enum class wake_path {
+  sem,
+#ifdef CONFIG_USERSPACE
+  futex,
+#endif
+  poll_signal,
+};
+
+constexpr const char* to_string(wake_path p) noexcept
+{
+  switch (p) {
+  case wake_path::sem:
+    return "sem";
+#ifdef CONFIG_USERSPACE
+  case wake_path::futex:
+    return "futex";
+#endif
+  case wake_path::poll_signal:
+    return "poll_signal";
+  }
+
+  return "?";
+}
+
+struct prio_pair {
+  const char*     name;
+  zpp::thread_prio waker;
+  zpp::thread_prio wakee;
+};
+
+const std::array<prio_pair, 6> g_prio_pairs{{
+  { "coop_to_higher_coop",       zpp::thread_prio(-1), zpp::thread_prio(-2) },
+  { "preempt_to_coop",           zpp::thread_prio(5),  zpp::thread_prio(-1) },
+  { "preempt_to_higher_preempt", zpp::thread_prio(5),  zpp::thread_prio(2)  },
+  { "preempt_to_equal_preempt",  zpp::thread_prio(5),  zpp::thread_prio(5)  },
+  { "preempt_to_lower_preempt",  zpp::thread_prio(5),  zpp::thread_prio(8)  },
+  { "coop_to_lower_preempt",     zpp::thread_prio(-1), zpp::thread_prio(5)  },
+}};
+
+zpp::latency_histogram<> g_hist;
+uint64_t g_sum_ns;
+
+zpp::cycle_clock::time_point g_wake_time;
+
+zpp::sem g_wake_sem(0, 1);
+zpp::sem g_done_sem(0, 1);
+zpp::poll_signal g_wake_signal;
+#ifdef CONFIG_USERSPACE
+zpp::futex g_wake_futex;
+#endif
+
+void wait_for_wake(wake_path path) noexcept
+{
+  switch (path) {
+  case wake_path::sem:
+    (void)g_wake_sem.take();
+    break;
+#ifdef CONFIG_USERSPACE
+  case wake_path::futex:
+    while (atomic_get(&g_wake_futex.native_handle()->val) == 0) {
+      (void)g_wake_futex.wait(0);
+    }
+    atomic_clear(&g_wake_futex.native_handle()->val);
+    break;
+#endif
+  case wake_path::poll_signal:
+    {
+      zpp::poll_event_set events{ g_wake_signal };
+      (void)events.poll();
+      g_wake_signal.reset();
+    }
+    break;
+  }
+}
+
+void wake(wake_path path) noexcept
+{
+  switch (path) {
+  case wake_path::sem:
+    g_wake_sem.give();
+    break;
+#ifdef CONFIG_USERSPACE
+  case wake_path::futex:
+    atomic_set(&g_wake_futex.native_handle()->val, 1);
+    g_wake_futex.wake_one();
+    break;
+#endif
+  case wake_path::poll_signal:
+    g_wake_signal.raise(1);
+    break;
+  }
+}
+
+void wakee(wake_path path) noexcept
+{
+  for (uint32_t i = 0; i < samples; ++i) {
+    wait_for_wake(path);
+
+    auto d = zpp::cycle_clock::now() - g_wake_time;
+
+    // the cycle_clock is 32 bit and may wrap between the two samples
+    if (d.count() < (uint64_t{1} << 63)) {
+      g_hist.record(d);
+      g_sum_ns += d.count();
+    }
+
+    g_done_sem.give();
+  }
+}
+
+void bench_wakeup(wake_path path, const prio_pair& prios) noexcept
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  g_hist.reset();
+  g_sum_ns = 0;
+
+  auto old_prio = this_thread::get_priority();
+  this_thread::set_priority(prios.waker);
+
+  const thread_attr attr(
+        prios.wakee,
+        thread_inherit_perms::no,
+        thread_essential::no,
+        thread_suspend::no
+      );
+
+  auto t = thread(g_wakee_tcb, g_wakee_stack(), attr, wakee, path);
+
+  for (uint32_t i = 0; i < samples; ++i) {
+    k_sleep(K_TICKS(1));
+
+    g_wake_time = cycle_clock::now();
+    wake(path);
+
+    (void)g_done_sem.take();
+  }
+
+  auto rc = t.join();
+  __ASSERT_NO_MSG(rc);
+  (void)rc;
+
+  this_thread::set_priority(old_prio);
+
+  auto n = static_cast<uint64_t>(g_hist.count());
+  zpp::print("BENCH,wakeup_latency,{},{},{},{},{},{},{}\n",
+             to_string(path), prios.name, n,
+             g_hist.min().count(),
+             n == 0 ? 0 : g_sum_ns / n,
+             g_hist.percentile(99).count(),
+             g_hist.max().count());
+}
+
+void bench_switch(const char* name, zpp::thread_prio prio) noexcept
+{
+  using namespace zpp;
+
+  auto old_prio = this_thread::get_priority();
+  this_thread::set_priority(prio);
+
+  const thread_attr attr(
+        prio,
+        thread_inherit_perms::no,
+        thread_essential::no,
+        thread_suspend::no
+      );
+
+  auto t = thread(g_wakee_tcb, g_wakee_stack(), attr,
+    []() noexcept {
+      for (uint32_t i = 0; i < yields; ++i) {
+        k_yield();
+      }
+    });
+
+  auto start = cycle_clock::now();
+  for (uint32_t i = 0; i < yields; ++i) {
+    k_yield();
+  }
+  auto rc = t.join();
+  auto d = cycle_clock::now() - start;
+
+  __ASSERT_NO_MSG(rc);
+  (void)rc;
+
+  this_thread::set_priority(old_prio);
+
+  zpp::print("BENCH,wakeup_latency,switch,{},{},{}\n",
+             name, 2 * yields, d.count() / (2 * yields));
+}
+
+} // namespace
+
+int main(void)
+{
+  for (auto path: { wake_path::sem,
+#ifdef CONFIG_USERSPACE
+                    wake_path::futex,
+#endif
+                    wake_path::poll_signal })
+  {
+    for (auto& prios: g_prio_pairs) {
+      bench_wakeup(path, prios);
+    }
+  }
+
+  bench_switch("coop", zpp::thread_prio(-1));
+  bench_switch("preempt", zpp::thread_prio(5));
+
+  zpp::print("BENCH,wakeup_latency,done\n");
+
+  return 0;
+}
@@ -0,0 +1,158 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+#include <zephyr/ztest.h>
+
+#include <zpp/broadcast.hpp>
+#include <zpp/heap.hpp>
+#include <zpp/thread.hpp>
+
+#include <chrono>
+
+ZTEST_SUITE(zpp_broadcast_tests, NULL, NULL, NULL, NULL, NULL);
+
+namespace {
+
+struct snapshot {
+  uint32_t seq;
+  uint32_t check;
+};
+
+constexpr int num_readers = 3;
+constexpr uint32_t num_items = 200;
+
+ZPP_THREAD_STACK_ARRAY_DEFINE(tstack, num_readers, 1024);
+zpp::thread_data tcb[num_readers];
+
+zpp::heap<1024> theap;
+
+zpp::broadcast<snapshot, 16> g_broadcast;
+
+const zpp::thread_attr attr(
+      zpp::thread_prio::preempt(0),
+      zpp::thread_inherit_perms::no,
+      zpp::thread_essential::no,
+      zpp::thread_suspend::no
+    );
+
+} // namespace
+
+ZTEST(zpp_broadcast_tests, test_publish_and_receive)
+{
+  zpp::broadcast<snapshot, 4> b;
+
+  zpp::broadcast<snapshot, 4>::reader early(b);
+
+  zassert_equal(early.available(), 0, "items before publish");
+  zassert_equal(early.try_receive().error(), zpp::error_code::k_nomsg,
+                "try_receive on empty ring did not fail");
+
+  for (uint32_t i = 0; i < 3; ++i) {
+    b.publish(snapshot{ i, ~i });
+  }
+
+  // a reader only sees what is published after it was created
+  zpp::broadcast<snapshot, 4>::reader late(b);
+  zassert_equal(late.available(), 0, "late reader sees old items");
+
+  zassert_equal(early.available(), 3, "wrong number of items");
+
+  for (uint32_t i = 0; i < 3; ++i) {
+    auto rc = early.try_receive();
+    zassert_true(rc == true, "try_receive failed");
+    zassert_equal(rc.value().seq, i, "wrong item");
+    zassert_equal(rc.value().check, ~i, "corrupted item");
+  }
+
+  zassert_false(early.try_receive(), "more items than published");
+  zassert_equal(early.lost(), 0, "items lost");
+  zassert_equal(b.published(), 3, "wrong published count");
+}
+
+ZTEST(zpp_broadcast_tests, test_overrun)
+{
+  zpp::broadcast<snapshot, 4> b;
+  zpp::broadcast<snapshot, 4>::reader r(b);
+
+  for (uint32_t i = 0; i < 10; ++i) {
+    b.publish(snapshot{ i, ~i });
+  }
+
+  zassert_equal(r.available(), 4, "more items than fit in the ring");
+
+  // the oldest items are lost, the newest are still there
+  for (uint32_t i = 6; i < 10; ++i) {
+    auto rc = r.try_receive();
+    zassert_true(rc == true, "try_receive failed");
+    zassert_equal(rc.value().seq, i, "wrong item after overrun");
+  }
+
+  zassert_equal(r.lost(), 6, "wrong number of lost items");
+  zassert_false(r.try_receive(), "more items than published");
+}
+
+ZTEST(zpp_broadcast_tests, test_receive_timeout)
+{
+  using namespace std::chrono;
+
+  zpp::broadcast<snapshot, 4> b;
+  zpp::broadcast<snapshot, 4>::reader r(b);
+
+  auto start = zpp::uptime_clock::now();
+  auto rc = r.try_receive_for(20ms);
+  zassert_false(rc, "try_receive_for on empty ring succeeded");
+  zassert_true(zpp::uptime_clock::now() - start >= 20ms, "woke up early");
+}
+
+ZTEST(zpp_broadcast_tests, test_blocking_readers)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  uint32_t received[num_readers]{};
+  uint32_t lost[num_readers]{};
+  thread t[num_readers];
+
+  // the readers exist before anything is published, so they see it all
+  for (int i = 0; i < num_readers; ++i) {
+    t[i] = thread(tcb[i], tstack(i), attr, &theap,
+      [&received, &lost, i]() noexcept {
+        broadcast<snapshot, 16>::reader r(g_broadcast);
+        uint32_t next = g_broadcast.published();
+
+        while (received[i] + r.lost() < num_items) {
+          auto rc = r.receive();
+          zassert_true(rc == true, "receive failed");
+          zassert_true(rc.value().seq >= next, "items out of order");
+          zassert_equal(rc.value().check, ~rc.value().seq, "corrupted item");
+          next = rc.value().seq + 1;
+          received[i]++;
+        }
+
+        lost[i] = r.lost();
+      });
+  }
+
+  // give the readers time to block
+  this_thread::sleep_for(10ms);
+
+  auto base = g_broadcast.published();
+  for (uint32_t i = 0; i < num_items; ++i) {
+    auto seq = base + i;
+    g_broadcast.publish(snapshot{ seq, ~seq });
+    if (i % 8 == 7) {
+      this_thread::sleep_for(1ms);
+    }
+  }
+
+  for (int i = 0; i < num_readers; ++i) {
+    auto rc = t[i].join();
+    zassert_true(rc == true, "join failed");
+    zassert_equal(received[i] + lost[i], num_items,
+                  "reader %d missed items", i);
+    zassert_true(received[i] > 0, "reader %d received nothing", i);
+  }
+}
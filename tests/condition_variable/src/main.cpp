@@ -20,6 +20,9 @@ namespace {
 ZPP_THREAD_STACK_DEFINE(tstack, 1024);
 zpp::thread_data tcb;
 
+ZPP_THREAD_STACK_DEFINE(tstack2, 1024);
+zpp::thread_data tcb2;
+
 
 bool ready = false;
 bool processed = false;
@@ -120,3 +123,146 @@ ZTEST(test_zpp_condition_variable, test_condition_variable)
     rc = t.join();
     __ASSERT_NO_MSG(rc == true);
 }
+
+ZTEST(test_zpp_condition_variable, test_condition_variable_until)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  zpp::lock_guard<zpp::mutex> lg(m);
+
+  auto deadline = uptime_clock::now() + 20ms;
+  auto rc = cv.try_wait_until(m, deadline);
+  zassert_false(rc, "wait without notify succeeded\n");
+  zassert_true(uptime_clock::now() >= deadline, "woke up before deadline\n");
+
+  deadline = uptime_clock::now() + 20ms;
+  rc = cv.try_wait_until(m, deadline, []{ return false; });
+  zassert_false(rc, "wait with false predicate succeeded\n");
+  zassert_true(uptime_clock::now() >= deadline, "woke up before deadline\n");
+
+  rc = cv.try_wait_until(m, uptime_clock::now(), []{ return true; });
+  zassert_true(rc == true, "wait with true predicate failed\n");
+}
+
+ZTEST(test_zpp_condition_variable, test_condition_variable_std_until)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  zpp::lock_guard<zpp::mutex> lg(m);
+
+  auto deadline = uptime_clock::now() + 20ms;
+  auto st = cv.wait_until(m, deadline);
+  zassert_true(st == cv_status::timeout, "wait without notify did not time out\n");
+  zassert_true(uptime_clock::now() >= deadline, "woke up before deadline\n");
+
+  auto res = cv.wait_until(m, uptime_clock::now() + 20ms, []{ return false; });
+  zassert_false(res, "wait with false predicate returned true\n");
+
+  res = cv.wait_for(m, 0ms, []{ return true; });
+  zassert_true(res, "wait with true predicate returned false\n");
+
+  st = cv.wait_for(m, 10ms);
+  zassert_true(st == cv_status::timeout, "wait without notify did not time out\n");
+}
+
+ZTEST(test_zpp_condition_variable, test_counting_condition_variable)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  static counting_condition_variable ccv;
+  static bool flag = false;
+
+  zassert_equal(ccv.waiters(), 0, "waiters before first wait\n");
+
+  // nobody waits, this must not enter the kernel and still succeed
+  auto rc = ccv.notify_all();
+  zassert_true(rc == true, "notify_all without waiters failed\n");
+
+  const thread_attr attr(
+        thread_prio::preempt(0),
+        thread_inherit_perms::no,
+        thread_essential::no,
+        thread_suspend::no
+      );
+
+  auto t = thread(
+    tcb, tstack(), attr,
+    []() noexcept {
+      zpp::lock_guard<zpp::mutex> lg(m);
+      auto res = ccv.wait_for(m, 1s, []{ return flag; });
+      __ASSERT_NO_MSG(res == true);
+    });
+
+  // let the thread block on the condition variable
+  this_thread::sleep_for(20ms);
+  zassert_equal(ccv.waiters(), 1, "waiter not counted\n");
+
+  rc = m.lock();
+  zassert_true(rc == true, "lock failed\n");
+  flag = true;
+  rc = ccv.notify_one_and_unlock(m);
+  zassert_true(rc == true, "notify_one_and_unlock failed\n");
+
+  rc = t.join();
+  zassert_true(rc == true, "join failed\n");
+  zassert_equal(ccv.waiters(), 0, "waiter still counted\n");
+}
+
+ZTEST(test_zpp_condition_variable, test_notify_all)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  static condition_variable acv;
+  static counting_condition_variable ccv;
+  static bool flag = false;
+  static bool counted_flag = false;
+
+  const thread_attr attr(
+        thread_prio::preempt(0),
+        thread_inherit_perms::no,
+        thread_essential::no,
+        thread_suspend::no
+      );
+
+  auto waiter = []() noexcept {
+      zpp::lock_guard<zpp::mutex> lg(m);
+      auto res = acv.wait_for(m, 1s, []{ return flag; });
+      __ASSERT_NO_MSG(res == true);
+      res = ccv.wait_for(m, 1s, []{ return counted_flag; });
+      __ASSERT_NO_MSG(res == true);
+    };
+
+  auto t1 = thread(tcb, tstack(), attr, waiter);
+  auto t2 = thread(tcb2, tstack2(), attr, waiter);
+
+  // let both threads block on the condition variable
+  this_thread::sleep_for(20ms);
+
+  auto rc = m.lock();
+  zassert_true(rc == true, "lock failed\n");
+  flag = true;
+  rc = acv.notify_all();
+  zassert_true(rc == true, "notify_all with waiters failed\n");
+  rc = m.unlock();
+  zassert_true(rc == true, "unlock failed\n");
+
+  // let both threads block on the counting condition variable
+  this_thread::sleep_for(20ms);
+  zassert_equal(ccv.waiters(), 2, "waiters not counted\n");
+
+  rc = m.lock();
+  zassert_true(rc == true, "lock failed\n");
+  counted_flag = true;
+  rc = ccv.notify_all_and_unlock(m);
+  zassert_true(rc == true, "notify_all_and_unlock with waiters failed\n");
+
+  rc = t1.join();
+  zassert_true(rc == true, "join failed\n");
+  rc = t2.join();
+  zassert_true(rc == true, "join failed\n");
+  zassert_equal(ccv.waiters(), 0, "waiters still counted\n");
+}
@@ -91,3 +91,90 @@ ZTEST(test_zpp_fifo, test_fifo)
     zassert_equal(res, &item, nullptr);
   }
 }
+
+ZTEST(test_zpp_fifo, test_fifo_timeouts)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  while (g_fifo.try_pop_front() != nullptr) {
+  }
+
+  auto start = uptime_clock::now();
+  auto res = g_fifo.try_pop_front_for(20ms);
+  zassert_is_null(res, "pop from empty fifo succeeded");
+  zassert_true(uptime_clock::now() - start >= 20ms, "did not wait");
+
+  auto deadline = uptime_clock::now() + 20ms;
+  res = g_fifo.try_pop_front_until(deadline);
+  zassert_is_null(res, "pop from empty fifo succeeded");
+  zassert_true(uptime_clock::now() >= deadline, "woke up before deadline");
+
+  g_fifo.push_back(&g_item_array[0]);
+  res = g_fifo.try_pop_front_until(uptime_clock::now() + 20ms);
+  zassert_equal(res, &g_item_array[0], nullptr);
+}
+
+ZTEST(test_zpp_fifo, test_fifo_push_back_list)
+{
+  while (g_fifo.try_pop_front() != nullptr) {
+  }
+
+  g_fifo.push_back_list(g_item_array.begin(), g_item_array.end());
+
+  for (auto& item: g_item_array) {
+    zassert_equal(g_fifo.try_pop_front(), &item, "wrong order");
+  }
+  zassert_true(g_fifo.empty(), "fifo not empty");
+
+  std::array<item*, 2> ptrs{ &g_item_array[1], &g_item_array[0] };
+  g_fifo.push_back_list(ptrs.begin(), ptrs.end());
+
+  zassert_equal(g_fifo.try_pop_front(), &g_item_array[1], "wrong order");
+  zassert_equal(g_fifo.try_pop_front(), &g_item_array[0], "wrong order");
+
+  // an empty range does nothing
+  g_fifo.push_back_list(ptrs.begin(), ptrs.begin());
+  zassert_true(g_fifo.empty(), "fifo not empty");
+}
+
+ZTEST(test_zpp_fifo, test_fifo_pop_all)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  auto list = g_fifo.try_pop_all();
+  zassert_true(list.empty(), "list from empty fifo not empty");
+
+  list = g_fifo.try_pop_all_for(10ms);
+  zassert_true(list.empty(), "list from empty fifo not empty");
+
+  for (auto& item: g_item_array) {
+    g_fifo.push_back(&item);
+  }
+
+  list = g_fifo.try_pop_all(3);
+  zassert_equal(list.size(), 3, "max_items not respected");
+  zassert_equal(list.front(), &g_item_array[0], "wrong order");
+
+  auto rest = g_fifo.pop_all();
+  zassert_equal(rest.size(), 1, "wrong number of items");
+  zassert_equal(rest.front(), &g_item_array[3], "wrong item");
+  zassert_true(g_fifo.empty(), "fifo not empty");
+
+  // items can be moved to another fifo while iterating
+  fifo<item> other;
+  size_t n = 0;
+  for (auto& i: list) {
+    zassert_equal(&i, &g_item_array[n], "wrong order");
+    other.push_back(&i);
+    n++;
+  }
+  zassert_equal(n, 3, "not all items visited");
+
+  list = other.try_pop_all_until(uptime_clock::now() + 10ms);
+  zassert_equal(list.size(), 3, "items lost");
+
+  g_fifo.push_back_list(list.begin(), list.end());
+  zassert_equal(g_fifo.try_pop_all().size(), 3, "items lost");
+}
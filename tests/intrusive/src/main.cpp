@@ -0,0 +1,227 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/kernel.h>
+
+#include <zpp/intrusive_slist.hpp>
+#include <zpp/intrusive_dlist.hpp>
+#include <zpp/intrusive_rbtree.hpp>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <ranges>
+
+ZTEST_SUITE(zpp_intrusive_tests, NULL, NULL, NULL, NULL, NULL);
+
+namespace {
+
+struct entry {
+  int           key{};
+  sys_snode_t   snode{};
+  sys_dnode_t   dnode{};
+  rbnode        tnode{};
+
+  friend bool operator<(const entry& lhs, const entry& rhs) noexcept
+  {
+    return lhs.key < rhs.key;
+  }
+
+  friend bool operator<(const entry& lhs, int rhs) noexcept
+  {
+    return lhs.key < rhs;
+  }
+
+  friend bool operator<(int lhs, const entry& rhs) noexcept
+  {
+    return lhs < rhs.key;
+  }
+};
+
+struct by_key_desc {
+  bool operator()(const entry& lhs, const entry& rhs) const noexcept
+  {
+    return lhs.key > rhs.key;
+  }
+};
+
+using slist_type = zpp::intrusive_slist<entry, &entry::snode>;
+using dlist_type = zpp::intrusive_dlist<entry, &entry::dnode>;
+using tree_type = zpp::intrusive_rbtree<entry, &entry::tnode>;
+
+static_assert(std::ranges::forward_range<slist_type>);
+static_assert(std::ranges::bidirectional_range<dlist_type>);
+static_assert(std::ranges::forward_range<tree_type>);
+static_assert(std::sentinel_for<std::default_sentinel_t, tree_type::iterator>);
+
+std::array<entry, 8> make_entries() noexcept
+{
+  std::array<entry, 8> e{};
+  for (size_t i = 0; i < e.size(); ++i) {
+    e[i].key = static_cast<int>(i);
+  }
+  return e;
+}
+
+} // namespace
+
+ZTEST(zpp_intrusive_tests, test_slist)
+{
+  auto e = make_entries();
+  slist_type l;
+
+  zassert_true(l.empty(), "new list not empty");
+  zassert_is_null(l.front(), "front of empty list");
+
+  l.push_back(e[1]);
+  l.push_back(e[2]);
+  l.push_front(e[0]);
+  l.insert_after(e[2], e[3]);
+
+  zassert_equal(l.size(), 4, "wrong size");
+  zassert_equal(l.front(), &e[0], "wrong front");
+  zassert_equal(l.back(), &e[3], "wrong back");
+
+  int expected = 0;
+  for (auto& i: l) {
+    zassert_equal(i.key, expected++, "wrong order");
+  }
+
+  zassert_true(l.remove(e[2]), "remove failed");
+  zassert_false(l.remove(e[2]), "removed twice");
+
+  slist_type other;
+  other.push_back(e[4]);
+  other.push_back(e[5]);
+  l.splice(other);
+
+  zassert_true(other.empty(), "spliced list not empty");
+  zassert_equal(l.size(), 5, "wrong size after splice");
+  zassert_equal(l.back(), &e[5], "wrong back after splice");
+
+  auto it = std::ranges::find_if(l, [](const entry& x) { return x.key == 4; });
+  zassert_true(it != l.end(), "find_if failed");
+  zassert_equal(&*it, &e[4], "wrong entry found");
+
+  zassert_equal(l.pop_front(), &e[0], "wrong pop");
+  l.clear();
+  zassert_true(l.empty(), "list not cleared");
+}
+
+ZTEST(zpp_intrusive_tests, test_dlist)
+{
+  auto e = make_entries();
+  dlist_type l;
+
+  for (auto& i: e) {
+    zassert_false(dlist_type::is_linked(i), "new entry linked");
+  }
+
+  l.push_back(e[1]);
+  l.push_back(e[3]);
+  l.push_front(e[0]);
+  l.insert_before(e[3], e[2]);
+
+  zassert_equal(l.size(), 4, "wrong size");
+  zassert_true(dlist_type::is_linked(e[2]), "entry not linked");
+
+  int expected = 0;
+  for (auto& i: l) {
+    zassert_equal(i.key, expected++, "wrong order");
+  }
+
+  // walk backwards
+  expected = 3;
+  for (auto& i: l | std::views::reverse) {
+    zassert_equal(i.key, expected--, "wrong reverse order");
+  }
+
+  // O(1) removal, e.g. to move an entry to the back of an LRU list
+  dlist_type::remove(e[1]);
+  zassert_false(dlist_type::is_linked(e[1]), "removed entry linked");
+  l.push_back(e[1]);
+  zassert_equal(l.back(), &e[1], "wrong back");
+
+  dlist_type other;
+  other.push_back(e[4]);
+  other.push_back(e[5]);
+  l.splice(other);
+
+  zassert_true(other.empty(), "spliced list not empty");
+  zassert_equal(l.size(), 6, "wrong size after splice");
+  zassert_equal(l.back(), &e[5], "wrong back after splice");
+  zassert_equal(l.pop_back(), &e[5], "wrong pop_back");
+  zassert_equal(l.pop_front(), &e[0], "wrong pop_front");
+
+  // splice into an empty list
+  dlist_type empty;
+  empty.splice(l);
+  zassert_true(l.empty(), "spliced list not empty");
+  zassert_equal(empty.size(), 4, "wrong size after splice");
+  zassert_equal(empty.front(), &e[2], "wrong front after splice");
+
+  empty.clear();
+  zassert_false(dlist_type::is_linked(e[2]), "cleared entry linked");
+}
+
+ZTEST(zpp_intrusive_tests, test_rbtree)
+{
+  auto e = make_entries();
+  tree_type t;
+
+  zassert_true(t.empty(), "new tree not empty");
+  zassert_is_null(t.min(), "min of empty tree");
+  zassert_true(t.begin() == t.end(), "empty tree not empty range");
+
+  const std::array<int, 8> order{ 5, 2, 7, 0, 3, 6, 1, 4 };
+  for (auto i: order) {
+    t.insert(e[i]);
+  }
+
+  zassert_equal(t.size(), 8, "wrong size");
+  zassert_equal(t.min(), &e[0], "wrong min");
+  zassert_equal(t.max(), &e[7], "wrong max");
+  zassert_true(t.contains(e[3]), "contains failed");
+
+  int expected = 0;
+  for (auto& i: t) {
+    zassert_equal(i.key, expected++, "not sorted");
+  }
+
+  zassert_equal(t.find(6), &e[6], "find failed");
+  zassert_is_null(t.find(42), "found missing key");
+
+  t.erase(e[3]);
+  zassert_false(t.contains(e[3]), "erase failed");
+  zassert_equal(t.lower_bound(3), &e[4], "wrong lower_bound");
+  zassert_is_null(t.lower_bound(8), "lower_bound past the end");
+
+  auto it = t.begin();
+  auto copy = it;
+  ++it;
+  zassert_equal(copy->key, 0, "copied iterator changed");
+  ++copy;
+  zassert_true(copy == it, "copied iterator diverged");
+
+  zassert_equal(std::ranges::distance(t), 7, "wrong distance");
+}
+
+ZTEST(zpp_intrusive_tests, test_rbtree_compare)
+{
+  auto e = make_entries();
+  zpp::intrusive_rbtree<entry, &entry::tnode, by_key_desc> t;
+
+  for (auto& i: e) {
+    t.insert(i);
+  }
+
+  int expected = 7;
+  for (auto& i: t) {
+    zassert_equal(i.key, expected--, "not sorted descending");
+  }
+}
@@ -0,0 +1,72 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/kernel.h>
+
+#include <zpp/latency_histogram.hpp>
+#include <zpp/thread.hpp>
+
+#include <chrono>
+
+ZTEST_SUITE(zpp_latency_histogram_tests, NULL, NULL, NULL, NULL, NULL);
+
+namespace {
+
+zpp::latency_histogram<16> g_hist;
+
+static_assert(decltype(g_hist)::bucket_index(std::chrono::nanoseconds(0)) == 0);
+static_assert(decltype(g_hist)::bucket_index(std::chrono::nanoseconds(1)) == 0);
+static_assert(decltype(g_hist)::bucket_index(std::chrono::nanoseconds(2)) == 1);
+static_assert(decltype(g_hist)::bucket_index(std::chrono::nanoseconds(3)) == 1);
+static_assert(decltype(g_hist)::bucket_index(std::chrono::nanoseconds(1024)) == 10);
+static_assert(decltype(g_hist)::bucket_index(std::chrono::seconds(1)) == 15);
+
+} // namespace
+
+ZTEST(zpp_latency_histogram_tests, test_histogram_record)
+{
+  using namespace std::chrono;
+
+  g_hist.reset();
+
+  zassert_true(g_hist.count() == 0, "histogram not empty");
+  zassert_true(g_hist.percentile(99) == nanoseconds(0), "p99 not 0");
+
+  g_hist.record(nanoseconds(100));
+  g_hist.record(nanoseconds(120));
+  g_hist.record(nanoseconds(5000));
+
+  zassert_true(g_hist.count() == 3, "count not 3");
+  zassert_true(g_hist.bucket(6) == 2, "bucket 6 should hold 2 samples");
+  zassert_true(g_hist.bucket(12) == 1, "bucket 12 should hold 1 sample");
+  zassert_true(g_hist.min() == nanoseconds(100), "min not 100ns");
+  zassert_true(g_hist.max() == nanoseconds(5000), "max not 5000ns");
+  zassert_true(g_hist.percentile(50) == nanoseconds(128), "p50 not 128ns");
+  zassert_true(g_hist.percentile(100) == nanoseconds(5000), "p100 not max");
+
+  g_hist.print("test_histogram_record");
+}
+
+ZTEST(zpp_latency_histogram_tests, test_scoped_probe)
+{
+  using namespace std::chrono;
+
+  g_hist.reset();
+
+  {
+    zpp::scoped_probe probe(g_hist);
+    zpp::this_thread::busy_wait_for(100us);
+  }
+
+#ifdef CONFIG_ZPP_LATENCY_PROBES
+  zassert_true(g_hist.count() == 1, "probe did not record");
+  zassert_true(g_hist.max() >= 100us, "probe recorded too short");
+#else
+  zassert_true(g_hist.count() == 0, "disabled probe recorded");
+#endif
+}
@@ -0,0 +1,123 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/kernel.h>
+
+#include <zpp/lifo.hpp>
+#include <zpp/fifo.hpp>
+#include <zpp/thread.hpp>
+
+#include <array>
+#include <chrono>
+
+ZTEST_SUITE(test_zpp_lifo, NULL, NULL, NULL, NULL, NULL);
+
+namespace {
+
+ZPP_THREAD_STACK_DEFINE(tstack, 1024);
+zpp::thread_data tcb;
+
+struct item {
+  void* lifo_reserved{};
+  uint32_t data{};
+};
+
+// the same item type can move between a fifo and a lifo
+struct shared_item {
+  void* fifo_reserved{};
+  uint32_t data{};
+};
+
+std::array<item, 4> g_item_array;
+
+zpp::lifo<item> g_lifo;
+
+} // namespace
+
+ZTEST(test_zpp_lifo, test_lifo_order)
+{
+  zassert_true(g_lifo.empty(), "lifo not empty");
+  zassert_is_null(g_lifo.top(), "top of empty lifo");
+
+  for (auto& item: g_item_array) {
+    g_lifo.push(&item);
+  }
+
+  zassert_false(g_lifo.empty(), "lifo empty");
+  zassert_equal(g_lifo.top(), &g_item_array[3], "wrong top item");
+
+  for (size_t i = g_item_array.size(); i > 0; --i) {
+    auto res = g_lifo.try_pop();
+    zassert_equal(res, &g_item_array[i - 1], "wrong order");
+  }
+
+  zassert_true(g_lifo.empty(), "lifo not empty");
+}
+
+ZTEST(test_zpp_lifo, test_lifo_thread)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  const thread_attr attr(
+        thread_prio::preempt(0),
+        thread_inherit_perms::yes,
+        thread_essential::no,
+        thread_suspend::no
+      );
+
+  auto t = thread(
+    tcb, tstack(), attr,
+    []() noexcept {
+      auto res = g_lifo.try_pop_for(1s);
+      __ASSERT_NO_MSG(res == &g_item_array[0]);
+      g_lifo.push(res);
+    });
+
+  this_thread::sleep_for(10ms);
+  g_lifo.push(&g_item_array[0]);
+
+  auto rc = t.join();
+  zassert_true(!!rc, "join failed");
+
+  zassert_equal(g_lifo.try_pop(), &g_item_array[0], "item not returned");
+}
+
+ZTEST(test_zpp_lifo, test_lifo_timeouts)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  auto start = uptime_clock::now();
+  auto res = g_lifo.try_pop_for(20ms);
+  zassert_is_null(res, "pop from empty lifo succeeded");
+  zassert_true(uptime_clock::now() - start >= 20ms, "did not wait");
+
+  auto deadline = uptime_clock::now() + 20ms;
+  res = g_lifo.try_pop_until(deadline);
+  zassert_is_null(res, "pop from empty lifo succeeded");
+  zassert_true(uptime_clock::now() >= deadline, "woke up before deadline");
+}
+
+ZTEST(test_zpp_lifo, test_lifo_fifo_item)
+{
+  zpp::lifo<shared_item> l;
+  zpp::fifo<shared_item> f;
+
+  shared_item a;
+  shared_item b;
+
+  l.push(&a);
+  l.push(&b);
+
+  f.push_back(l.try_pop());
+  f.push_back(l.try_pop());
+
+  zassert_equal(f.try_pop_front(), &b, "wrong order");
+  zassert_equal(f.try_pop_front(), &a, "wrong order");
+}
@@ -0,0 +1,181 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/kernel.h>
+
+#include <zpp/lock_stats.hpp>
+#include <zpp/mutex.hpp>
+#include <zpp/sem.hpp>
+#include <zpp/condition_variable.hpp>
+#include <zpp/thread.hpp>
+
+#include <chrono>
+#include <cstring>
+
+ZTEST_SUITE(zpp_lock_stats_tests, NULL, NULL, NULL, NULL, NULL);
+
+namespace {
+
+#ifdef CONFIG_ZPP_LOCK_STATS
+ZPP_THREAD_STACK_DEFINE(tstack, 1024);
+zpp::thread_data tcb;
+
+zpp::mutex g_mutex;
+zpp::sem g_sem;
+
+K_SEM_DEFINE(g_mutex_locked, 0, 1);
+#endif
+
+K_MUTEX_DEFINE(g_native_mutex);
+
+// references never carry statistics
+static_assert(sizeof(zpp::mutex_ref) == sizeof(k_mutex*));
+static_assert(!zpp::mutex_ref::lock_stats_type::enabled);
+
+#ifndef CONFIG_ZPP_LOCK_STATS
+static_assert(sizeof(zpp::mutex) == sizeof(k_mutex));
+static_assert(sizeof(zpp::sem) == sizeof(k_sem));
+static_assert(sizeof(zpp::condition_variable) == sizeof(k_condvar));
+#endif
+
+} // namespace
+
+#ifdef CONFIG_ZPP_LOCK_STATS
+
+ZTEST(zpp_lock_stats_tests, test_mutex_stats)
+{
+  using namespace std::chrono;
+
+  g_mutex.stats().reset();
+
+  auto rc = g_mutex.lock();
+  zassert_true(!!rc, "lock failed");
+  rc = g_mutex.lock();
+  zassert_true(!!rc, "recursive lock failed");
+
+  zpp::this_thread::sleep_for(10ms);
+
+  rc = g_mutex.unlock();
+  zassert_true(!!rc, "unlock failed");
+  rc = g_mutex.unlock();
+  zassert_true(!!rc, "unlock failed");
+
+  auto s = g_mutex.stats().snapshot();
+
+  zassert_true(s.kind == zpp::lock_kind::mutex, "wrong kind");
+  zassert_true(s.acquisitions == 2, "wrong number of acquisitions");
+  zassert_true(s.contended == 0, "unexpected contention");
+  zassert_true(s.total_hold >= 9ms, "hold time too short");
+  zassert_true(s.max_hold == s.total_hold, "only one hold expected");
+}
+
+ZTEST(zpp_lock_stats_tests, test_mutex_contention)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  g_mutex.stats().reset();
+
+  const thread_attr attr(
+        thread_prio::preempt(0),
+        thread_inherit_perms::no,
+        thread_essential::no,
+        thread_suspend::no
+      );
+
+  auto t = thread(
+    tcb, tstack(), attr,
+    []() noexcept {
+      auto rc = g_mutex.lock();
+      __ASSERT_NO_MSG(rc == true);
+
+      k_sem_give(&g_mutex_locked);
+
+      this_thread::sleep_for(20ms);
+
+      rc = g_mutex.unlock();
+      __ASSERT_NO_MSG(rc == true);
+    });
+
+  k_sem_take(&g_mutex_locked, K_FOREVER);
+
+  auto rc = g_mutex.lock();
+  zassert_true(!!rc, "lock failed");
+  rc = g_mutex.unlock();
+  zassert_true(!!rc, "unlock failed");
+
+  auto jrc = t.join();
+  zassert_true(!!jrc, "join failed");
+
+  auto s = g_mutex.stats().snapshot();
+
+  zassert_true(s.acquisitions == 2, "wrong number of acquisitions");
+  zassert_true(s.contended == 1, "contention not detected");
+  zassert_true(s.max_wait >= 10ms, "wait time too short");
+  zassert_true(s.total_hold >= 19ms, "hold time too short");
+}
+
+ZTEST(zpp_lock_stats_tests, test_sem_stats)
+{
+  using namespace std::chrono;
+
+  g_sem.stats().reset();
+
+  zassert_false(g_sem.try_take(), "sem should be empty");
+
+  g_sem.give();
+  zassert_true(g_sem.try_take_for(10ms), "take failed");
+
+  auto s = g_sem.stats().snapshot();
+
+  zassert_true(s.kind == zpp::lock_kind::sem, "wrong kind");
+  zassert_true(s.acquisitions == 1, "failed take was counted");
+  zassert_true(s.contended == 0, "unexpected contention");
+}
+
+ZTEST(zpp_lock_stats_tests, test_registry)
+{
+  g_mutex.stats().set_name("g_mutex");
+
+  bool found = false;
+  {
+    zpp::mutex local;
+    local.stats().set_name("local");
+
+    int n = 0;
+    zpp::for_each_lock_stats([&](const zpp::lock_stats_snapshot& s) noexcept {
+      if (s.name != nullptr && strcmp(s.name, "local") == 0) {
+        n++;
+      }
+      if (s.object == &g_mutex) {
+        found = true;
+      }
+    });
+    zassert_true(n == 1, "local mutex not registered");
+  }
+
+  zassert_true(found, "global mutex not registered");
+
+  zpp::for_each_lock_stats([](const zpp::lock_stats_snapshot& s) noexcept {
+    __ASSERT_NO_MSG(s.name == nullptr || strcmp(s.name, "local") != 0);
+  });
+
+  zpp::print_lock_stats_top<4>();
+}
+
+#endif // CONFIG_ZPP_LOCK_STATS
+
+ZTEST(zpp_lock_stats_tests, test_mutex_ref_uninstrumented)
+{
+  zpp::mutex_ref m(&g_native_mutex);
+
+  auto rc = m.lock();
+  zassert_true(!!rc, "lock failed");
+  rc = m.unlock();
+  zassert_true(!!rc, "unlock failed");
+}
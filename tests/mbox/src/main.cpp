@@ -0,0 +1,162 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/kernel.h>
+
+#include <zpp/mbox.hpp>
+#include <zpp/sem.hpp>
+#include <zpp/thread.hpp>
+
+#include <array>
+#include <chrono>
+#include <span>
+
+ZTEST_SUITE(zpp_mbox_tests, NULL, NULL, NULL, NULL, NULL);
+
+namespace {
+
+ZPP_THREAD_STACK_DEFINE(tstack, 1024);
+zpp::thread_data tcb;
+
+// never started, only used as a target that never receives
+zpp::thread_data g_other_tcb;
+
+struct request {
+  uint32_t cmd{};
+  uint32_t arg{};
+};
+
+zpp::mbox g_mbox;
+zpp::thread_id g_handler_id;
+
+} // namespace
+
+ZTEST(zpp_mbox_tests, test_mbox_exchange)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  const thread_attr attr(
+        thread_prio::preempt(0),
+        thread_inherit_perms::no,
+        thread_essential::no,
+        thread_suspend::no
+      );
+
+  auto t = thread(
+    tcb, tstack(), attr,
+    []() noexcept {
+      g_handler_id = this_thread::get_id();
+
+      std::array<request, 1> req{};
+      auto res = g_mbox.receive(std::span(req), thread_id::any(), 0xCAFE);
+      __ASSERT_NO_MSG(res);
+      __ASSERT_NO_MSG(res->size == sizeof(request));
+      __ASSERT_NO_MSG(res->info == 7);
+      __ASSERT_NO_MSG(req[0].cmd == 1 && req[0].arg == 42);
+    });
+
+  this_thread::sleep_for(10ms);
+
+  const std::array<request, 1> req{ request{ 1, 42 } };
+  auto res = g_mbox.send(std::span(req), g_handler_id, 7);
+  zassert_true(!!res, "send failed");
+
+  // the sender returns after the receiver took the data
+  zassert_equal(res->size, sizeof(request), "wrong size");
+  zassert_equal(res->info, 0xCAFE, "wrong reply info");
+  zassert_true(res->peer == g_handler_id, "wrong receiver");
+
+  auto jrc = t.join();
+  zassert_true(!!jrc, "join failed");
+}
+
+ZTEST(zpp_mbox_tests, test_mbox_no_peer)
+{
+  using namespace std::chrono;
+
+  std::array<uint8_t, 4> buf{};
+
+  auto rres = g_mbox.try_receive(std::span(buf));
+  zassert_false(!!rres, "receive without sender succeeded");
+  zassert_equal(rres.error(), zpp::error_code::k_nomsg, "wrong error");
+
+  auto sres = g_mbox.try_send(std::span(buf));
+  zassert_false(!!sres, "send without receiver succeeded");
+  zassert_equal(sres.error(), zpp::error_code::k_nomsg, "wrong error");
+
+  sres = g_mbox.try_send_for(std::span(buf), 10ms);
+  zassert_false(!!sres, "send without receiver succeeded");
+  zassert_equal(sres.error(), zpp::error_code::k_again, "wrong error");
+
+  rres = g_mbox.try_receive_until(std::span(buf),
+                                  zpp::uptime_clock::now() + 10ms);
+  zassert_false(!!rres, "receive without sender succeeded");
+  zassert_equal(rres.error(), zpp::error_code::k_again, "wrong error");
+}
+
+ZTEST(zpp_mbox_tests, test_mbox_target_filter)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  const thread_attr attr(
+        thread_prio::preempt(0),
+        thread_inherit_perms::no,
+        thread_essential::no,
+        thread_suspend::no
+      );
+
+  auto t = thread(
+    tcb, tstack(), attr,
+    []() noexcept {
+      g_handler_id = this_thread::get_id();
+
+      std::array<uint8_t, 4> rx{};
+      auto res = g_mbox.try_receive_for(std::span(rx), 1s);
+      __ASSERT_NO_MSG(res);
+      __ASSERT_NO_MSG(res->size == rx.size());
+    });
+
+  this_thread::sleep_for(10ms);
+
+  std::array<uint8_t, 4> buf{ 1, 2, 3, 4 };
+
+  // a message for another thread is not delivered to the waiting handler
+  auto res = g_mbox.try_send_for(std::span(buf), 20ms,
+                                 thread_id(g_other_tcb.native_handle()));
+  zassert_false(!!res, "message for other thread delivered");
+
+  res = g_mbox.try_send_for(std::span(buf), 1s, g_handler_id);
+  zassert_true(!!res, "send failed");
+  zassert_true(res->peer == g_handler_id, "wrong receiver");
+
+  auto jrc = t.join();
+  zassert_true(!!jrc, "join failed");
+}
+
+ZTEST(zpp_mbox_tests, test_mbox_async)
+{
+  using namespace std::chrono;
+
+  std::array<uint8_t, 4> buf{ 1, 2, 3, 4 };
+
+  zpp::sem done;
+  g_mbox.async_send(std::span(buf), done);
+
+  zassert_false(done.try_take(), "async send completed early");
+
+  std::array<uint8_t, 4> rx{};
+  auto res = g_mbox.try_receive_for(std::span(rx), 10ms);
+  zassert_true(!!res, "receive failed");
+  zassert_equal(res->size, buf.size(), "wrong size");
+  zassert_true(res->peer == zpp::this_thread::get_id(), "wrong sender");
+  zassert_true(rx == buf, "data mismatch");
+
+  zassert_true(done.try_take_for(10ms), "async send not completed");
+}
@@ -0,0 +1,117 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/kernel.h>
+
+#include <zpp/msgq.hpp>
+#include <zpp/thread.hpp>
+
+#include <chrono>
+
+ZTEST_SUITE(test_zpp_msgq, NULL, NULL, NULL, NULL, NULL);
+
+namespace {
+
+ZPP_THREAD_STACK_DEFINE(tstack, 1024);
+zpp::thread_data tcb;
+
+struct message {
+  uint16_t id;
+  int32_t  value;
+};
+
+zpp::msgq<message, 4> g_msgq;
+
+K_MSGQ_DEFINE(g_native_msgq, sizeof(message), 2, 4);
+
+} // namespace
+
+ZTEST(test_zpp_msgq, test_msgq_send_receive)
+{
+  zpp::msgq<message, 2> q;
+
+  zassert_equal(q.num_free(), 2, "wrong free count");
+
+  zassert_true(!!q.try_send({ 1, 100 }), "send failed");
+  zassert_true(!!q.try_send({ 2, 200 }), "send failed");
+  zassert_equal(q.num_used(), 2, "wrong used count");
+
+  auto rc = q.try_send({ 3, 300 });
+  zassert_false(!!rc, "send to full queue succeeded");
+  zassert_equal(rc.error(), zpp::error_code::k_nomsg, "wrong error");
+
+  auto res = q.peek();
+  zassert_true(!!res, "peek failed");
+  zassert_equal(res.value().id, 1, "wrong message");
+  zassert_equal(q.num_used(), 2, "peek removed the message");
+
+  res = q.try_receive();
+  zassert_true(!!res, "receive failed");
+  zassert_equal(res.value().id, 1, "wrong order");
+
+  res = q.try_receive();
+  zassert_true(!!res, "receive failed");
+  zassert_equal(res.value().value, 200, "wrong order");
+
+  res = q.try_receive();
+  zassert_false(!!res, "receive from empty queue succeeded");
+  zassert_equal(res.error(), zpp::error_code::k_nomsg, "wrong error");
+
+  zassert_true(!!q.try_send({ 4, 400 }), "send failed");
+  q.purge();
+  zassert_equal(q.num_used(), 0, "purge left messages");
+}
+
+ZTEST(test_zpp_msgq, test_msgq_ref)
+{
+  zpp::msgq_ref<message> r(&g_native_msgq);
+
+  zassert_true(!!r.try_send({ 5, 500 }), "send failed");
+  zassert_equal(k_msgq_num_used_get(&g_native_msgq), 1, "not sent to native queue");
+
+  auto res = r.try_receive();
+  zassert_true(!!res, "receive failed");
+  zassert_equal(res.value().id, 5, "wrong message");
+}
+
+ZTEST(test_zpp_msgq, test_msgq_thread)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  const thread_attr attr(
+        thread_prio::preempt(0),
+        thread_inherit_perms::yes,
+        thread_essential::no,
+        thread_suspend::no
+      );
+
+  auto t = thread(
+    tcb, tstack(), attr,
+    []() noexcept {
+      auto res = g_msgq.try_receive_for(1s);
+      __ASSERT_NO_MSG(res && res.value().id == 6);
+      auto rc = g_msgq.send({ 7, res.value().value + 1 });
+      __ASSERT_NO_MSG(rc);
+    });
+
+  this_thread::sleep_for(10ms);
+  zassert_true(!!g_msgq.send({ 6, 600 }), "send failed");
+
+  auto rc = t.join();
+  zassert_true(!!rc, "join failed");
+
+  auto res = g_msgq.try_receive_until(uptime_clock::now() + 10ms);
+  zassert_true(!!res, "receive failed");
+  zassert_equal(res.value().id, 7, "wrong message");
+  zassert_equal(res.value().value, 601, "wrong value");
+
+  res = g_msgq.try_receive_for(10ms);
+  zassert_false(!!res, "receive from empty queue succeeded");
+  zassert_equal(res.error(), zpp::error_code::k_again, "wrong error");
+}
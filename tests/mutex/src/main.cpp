@@ -95,3 +95,16 @@ ZTEST(test_zpp_mutex, test_lock_guard)
   zpp::lock_guard g(m);
   zpp::lock_guard g_ref(m_ref);
 }
+
+ZTEST(test_zpp_mutex, test_mutex_try_lock_until)
+{
+  using namespace std::chrono;
+
+  auto rc = m.try_lock_until(zpp::uptime_clock::now() + 10ms);
+
+  zassert_true(!!rc, "Failed to lock mutex: %d\n", rc.error());
+
+  rc = m.unlock();
+
+  zassert_true(!!rc, "Failed to unlock mutex: %d\n", rc.error());
+}
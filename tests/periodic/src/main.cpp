@@ -0,0 +1,89 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/kernel.h>
+
+#include <zpp/periodic.hpp>
+#include <zpp/thread.hpp>
+
+#include <chrono>
+
+ZTEST_SUITE(zpp_periodic_tests, NULL, NULL, NULL, NULL, NULL);
+
+ZTEST(zpp_periodic_tests, test_periodic_no_drift)
+{
+  using namespace std::chrono;
+
+  zpp::periodic p(10ms);
+
+  auto first = p.next_release();
+  uint32_t missed = 0;
+
+  for (int i = 0; i < 10; ++i) {
+    auto release = p.next_release();
+
+    missed += p.wait();
+    zassert_true(zpp::uptime_clock::now() >= release, "released too early");
+
+    // variable amount of work must not shift the releases
+    zpp::this_thread::busy_wait_for(milliseconds(i % 4));
+  }
+
+  // a release missed because the host was slow is skipped, it does not
+  // shift the ones after it
+  zassert_true(p.overruns() == missed, "overruns not counted");
+  zassert_true(p.next_release() == first + (10 + missed) * 10ms,
+               "release phase changed");
+}
+
+ZTEST(zpp_periodic_tests, test_periodic_overrun)
+{
+  using namespace std::chrono;
+
+  zpp::periodic p(10ms, 5ms);
+
+  auto first = p.next_release();
+  auto missed = p.wait();
+
+  auto release = p.next_release();
+  zassert_true(release == first + (missed + 1) * 10ms, "release phase changed");
+
+  // miss at least the next two releases completely
+  zpp::this_thread::busy_wait_for(35ms);
+
+  auto more = p.wait();
+  zassert_true(more >= 2, "expected at least two missed releases");
+  zassert_true(p.overruns() == missed + more, "overruns not counted");
+
+  // the phase of the releases is kept
+  zassert_true(p.next_release() == release + (more + 1) * 10ms,
+               "release phase changed");
+
+  p.reset();
+  zassert_true(p.overruns() == 0, "reset did not clear overruns");
+}
+
+#ifdef CONFIG_SCHED_DEADLINE
+ZTEST(zpp_periodic_tests, test_thread_deadline)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  static_assert(std::is_same_v<decltype(thread_deadline{ 1ms }.t), milliseconds>);
+
+  this_thread::set_deadline(1ms);
+
+  const thread_attr attr(
+        this_thread::get_priority(),
+        thread_deadline{ 2ms }
+      );
+
+  zassert_true(attr.has_deadline(), "deadline not set");
+  zassert_true(attr.native_deadline() > 0, "deadline not converted");
+}
+#endif // CONFIG_SCHED_DEADLINE
@@ -0,0 +1,203 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/kernel.h>
+
+#include <zpp/pipe.hpp>
+#include <zpp/poll.hpp>
+#include <zpp/thread.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <span>
+
+ZTEST_SUITE(zpp_pipe_tests, NULL, NULL, NULL, NULL, NULL);
+
+namespace {
+
+ZPP_THREAD_STACK_DEFINE(tstack, 1024);
+zpp::thread_data tcb;
+
+zpp::pipe<64> g_pipe;
+
+K_PIPE_DEFINE(g_native_pipe, 32, 4);
+
+const std::array<std::byte, 8> g_pattern{
+  std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4},
+  std::byte{5}, std::byte{6}, std::byte{7}, std::byte{8},
+};
+
+} // namespace
+
+ZTEST(zpp_pipe_tests, test_pipe_write_read)
+{
+  g_pipe.flush();
+
+  zassert_equal(g_pipe.read_avail(), 0, "pipe not empty");
+  zassert_equal(g_pipe.write_avail(), 64, "wrong free space");
+
+  auto wrc = g_pipe.write(g_pattern);
+  zassert_true(!!wrc, "write failed");
+  zassert_equal(wrc.value(), g_pattern.size(), "short write");
+
+  zassert_equal(g_pipe.read_avail(), g_pattern.size(), "wrong fill level");
+
+  std::array<std::byte, 8> buf{};
+  auto rrc = g_pipe.read(buf);
+  zassert_true(!!rrc, "read failed");
+  zassert_equal(rrc.value(), buf.size(), "short read");
+  zassert_true(memcmp(buf.data(), g_pattern.data(), buf.size()) == 0,
+               "data mismatch");
+}
+
+ZTEST(zpp_pipe_tests, test_pipe_try)
+{
+  g_pipe.flush();
+
+  std::array<std::byte, 8> buf{};
+
+  // nothing to read, but nothing was required either
+  auto rrc = g_pipe.try_read(buf, 0);
+  zassert_true(!!rrc, "try_read failed");
+  zassert_equal(rrc.value(), 0, "unexpected data");
+
+  // requiring data from an empty pipe fails
+  rrc = g_pipe.try_read(buf, 1);
+  zassert_false(!!rrc, "try_read with min_bytes succeeded");
+
+  // fill the pipe, the last write only fits partially
+  for (int i = 0; i < 8; ++i) {
+    auto wrc = g_pipe.try_write(g_pattern, g_pattern.size());
+    zassert_true(!!wrc, "try_write failed");
+  }
+
+  auto wrc = g_pipe.try_write(g_pattern, g_pattern.size());
+  zassert_false(!!wrc, "write to full pipe succeeded");
+
+  rrc = g_pipe.try_read(std::span(buf).first(4), 4);
+  zassert_true(!!rrc, "try_read failed");
+  zassert_equal(rrc.value(), 4, "short read");
+
+  // without a minimum the part that fits is written
+  wrc = g_pipe.try_write(g_pattern, 0);
+  zassert_true(!!wrc, "try_write failed");
+  zassert_equal(wrc.value(), 4, "wrong partial write");
+
+  g_pipe.buffer_flush();
+  zassert_equal(g_pipe.read_avail(), 0, "pipe not flushed");
+}
+
+ZTEST(zpp_pipe_tests, test_pipe_timeout)
+{
+  using namespace std::chrono;
+
+  g_pipe.flush();
+
+  std::array<std::byte, 8> buf{};
+
+  auto start = zpp::uptime_clock::now();
+  auto rrc = g_pipe.try_read_for(buf, 20ms);
+  auto elapsed = zpp::uptime_clock::now() - start;
+
+  zassert_false(!!rrc, "read from empty pipe succeeded");
+  zassert_true(elapsed >= 20ms, "timeout too short");
+
+  rrc = g_pipe.try_read_until(buf, zpp::uptime_clock::now() + 10ms);
+  zassert_false(!!rrc, "read from empty pipe succeeded");
+
+  // a partial transfer is returned as a short count, even when it is
+  // less than the minimum
+  auto wrc = g_pipe.write(std::span(g_pattern).first(3));
+  zassert_true(!!wrc, "write failed");
+
+  rrc = g_pipe.try_read_for(buf, 10ms);
+  zassert_true(!!rrc, "partial read failed");
+  zassert_equal(rrc.value(), 3, "wrong partial read");
+
+  wrc = g_pipe.write(std::span(g_pattern).first(3));
+  zassert_true(!!wrc, "write failed");
+
+  rrc = g_pipe.try_read_for(buf, 10ms, 5);
+  zassert_true(!!rrc, "partial read failed");
+  zassert_equal(rrc.value(), 3, "wrong partial read");
+
+  // without a wait the minimum is all or nothing
+  wrc = g_pipe.write(std::span(g_pattern).first(3));
+  zassert_true(!!wrc, "write failed");
+
+  rrc = g_pipe.try_read(buf);
+  zassert_false(!!rrc, "try_read of a whole buffer succeeded");
+  zassert_equal(g_pipe.read_avail(), 3, "data lost");
+}
+
+ZTEST(zpp_pipe_tests, test_pipe_thread)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  g_pipe.flush();
+
+  const thread_attr attr(
+        thread_prio::preempt(0),
+        thread_inherit_perms::no,
+        thread_essential::no,
+        thread_suspend::no
+      );
+
+  auto t = thread(
+    tcb, tstack(), attr,
+    []() noexcept {
+      for (int i = 0; i < 32; ++i) {
+        auto rc = g_pipe.write(g_pattern);
+        __ASSERT_NO_MSG(rc && rc.value() == g_pattern.size());
+      }
+    });
+
+  std::array<std::byte, 32> buf{};
+  size_t total = 0;
+
+  while (total < 32 * g_pattern.size()) {
+    auto rc = g_pipe.try_read_for(buf, 1s, 1);
+    zassert_true(!!rc, "read failed");
+
+    for (size_t i = 0; i < rc.value(); ++i) {
+      zassert_equal(buf[i], g_pattern[(total + i) % g_pattern.size()],
+                    "stream out of order");
+    }
+
+    total += rc.value();
+  }
+
+  auto jrc = t.join();
+  zassert_true(!!jrc, "join failed");
+}
+
+ZTEST(zpp_pipe_tests, test_pipe_poll)
+{
+  using namespace std::chrono;
+
+  g_pipe.flush();
+
+  zpp::pipe_ref r(&g_native_pipe);
+  zpp::poll_event_set events{ g_pipe, r };
+
+  zassert_false(events.try_poll_for(10ms), "empty pipes are ready");
+
+  auto wrc = r.write(std::span(g_pattern).first(4));
+  zassert_true(!!wrc, "write failed");
+
+  zassert_true(events.try_poll_for(10ms), "poll failed");
+  zassert_false(events[0].is_ready(), "wrong pipe ready");
+  zassert_true(events[1].is_ready(), "pipe not ready");
+
+  std::array<std::byte, 4> buf{};
+  auto rrc = events[1].pipe().try_read(buf);
+  zassert_true(!!rrc, "read failed");
+  zassert_equal(rrc.value(), 4, "short read");
+}
@@ -12,6 +12,7 @@
 #include <zpp/poll.hpp>
 #include <zpp/sem.hpp>
 #include <zpp/fifo.hpp>
+#include <zpp/msgq.hpp>
 
 
 ZTEST_SUITE(zpp_poll_tests, NULL, NULL, NULL, NULL, NULL);
@@ -36,6 +37,8 @@ zpp::sem            wait_sem;
 zpp::fifo<fifo_msg> wait_fifo;
 zpp::poll_signal    wait_signal;
 
+K_MSGQ_DEFINE(native_q, sizeof(uint32_t), 2, 4);
+
 zpp::poll_event_set wait_events {
   wait_sem,
   wait_fifo,
@@ -212,3 +215,33 @@ ZTEST(zpp_poll_tests, test_poll_wait)
   wait_events[2].reset();
   wait_signal.reset();
 }
+
+#ifdef K_POLL_TYPE_MSGQ_DATA_AVAILABLE
+ZTEST(zpp_poll_tests, test_poll_msgq)
+{
+  using namespace std::chrono;
+
+  zpp::sem               sem;
+  zpp::msgq<uint32_t, 4> q;
+  zpp::msgq_ref<uint32_t> r(&native_q);
+
+  zpp::poll_event_set events{ sem, q, r };
+
+  zassert_false(events.try_poll_for(10ms), "empty queues are ready");
+
+  auto src = r.try_send(FIFO_MSG_VALUE);
+  zassert_true(!!src, "send failed");
+
+  zassert_true(events.try_poll_for(10ms), "poll failed");
+  zassert_false(events[0].is_ready(), "sem ready");
+  zassert_false(events[1].is_ready(), "wrong queue ready");
+  zassert_true(events[2].is_ready(), "queue not ready");
+
+  auto rrc = events[2].msgq<uint32_t>().try_receive();
+  zassert_true(!!rrc, "receive failed");
+  zassert_equal(rrc.value(), FIFO_MSG_VALUE, "wrong message");
+
+  events[2].reset();
+  zassert_false(events.try_poll_for(10ms), "empty queues are ready");
+}
+#endif
@@ -34,8 +34,110 @@ private:
   int m_data{42};
 };
 
+class MoveOnly {
+public:
+  MoveOnly() = delete;
+  explicit MoveOnly(int v) noexcept : m_data(v) {}
+  MoveOnly(const MoveOnly&) = delete;
+  MoveOnly(MoveOnly&& other) noexcept : m_data(other.m_data) { other.m_data = 0; }
+  MoveOnly& operator=(const MoveOnly&) = delete;
+  MoveOnly& operator=(MoveOnly&& other) noexcept {
+    m_data = other.m_data;
+    other.m_data = 0;
+    return *this;
+  }
+
+  int data() const noexcept { return m_data; }
+private:
+  int m_data{42};
+};
+
+using int_result = zpp::result<int, zpp::error_code>;
+using void_result = zpp::result<void, zpp::error_code>;
+using move_only_result = zpp::result<MoveOnly, zpp::error_code>;
+
+static_assert(std::is_trivially_copyable_v<int_result>);
+static_assert(std::is_trivially_destructible_v<int_result>);
+static_assert(std::is_trivially_copyable_v<void_result>);
+
+static_assert(!std::is_copy_constructible_v<move_only_result>);
+static_assert(!std::is_copy_assignable_v<move_only_result>);
+static_assert(std::is_move_constructible_v<move_only_result>);
+static_assert(std::is_move_assignable_v<move_only_result>);
+static_assert(!std::is_trivially_copyable_v<move_only_result>);
+
+int_result half(int v) noexcept
+{
+  if (v % 2 != 0) {
+    return zpp::error_result(zpp::error_code::k_inval);
+  }
+
+  return v / 2;
+}
+
 } // namespace
 
+ZTEST(test_zpp_result, test_result_move_only)
+{
+  move_only_result res_a(MoveOnly(7));
+  zassert_true(res_a == true, "res_a should be true\n");
+
+  auto res_b = std::move(res_a);
+  zassert_true(res_b.value().data() == 7, "res_b should hold 7\n");
+
+  move_only_result res_c;
+  res_c = std::move(res_b);
+  zassert_true(res_c.value().data() == 7, "res_c should hold 7\n");
+
+  auto res_d = std::move(res_c).transform([](MoveOnly&& m) noexcept {
+      return m.data() * 2;
+    });
+  zassert_true(res_d.value() == 14, "transform should give 14\n");
+}
+
+ZTEST(test_zpp_result, test_result_monadic)
+{
+  int_result res_a(8);
+
+  auto res_b = res_a.and_then(half).and_then(half);
+  zassert_true(res_b.value() == 2, "8 / 2 / 2 should be 2\n");
+
+  auto res_c = res_a.and_then(half).and_then(half).and_then(half).and_then(half);
+  zassert_true(res_c == false, "1 / 2 should fail\n");
+  zassert_true(res_c.error() == zpp::error_code::k_inval, "wrong error\n");
+
+  auto res_d = res_c.or_else([](zpp::error_code) noexcept {
+      return int_result(-1);
+    });
+  zassert_true(res_d.value() == -1, "or_else should give -1\n");
+
+  auto res_e = res_a.transform([](int v) noexcept { return v > 4; });
+  static_assert(std::is_same_v<decltype(res_e), zpp::result<bool, zpp::error_code>>);
+  zassert_true(res_e.value(), "transform should give true\n");
+
+  int calls = 0;
+  auto res_f = res_c.transform([&calls](int) noexcept { calls++; });
+  static_assert(std::is_same_v<decltype(res_f), void_result>);
+  zassert_true(res_f == false, "transform of error should fail\n");
+  zassert_true(calls == 0, "transform called on error\n");
+
+  void_result res_g;
+  res_g.assign_value();
+
+  auto res_h = res_g.and_then([]() noexcept { return int_result(3); });
+  zassert_true(res_h.value() == 3, "and_then on void should give 3\n");
+
+  res_g.assign_error(zpp::error_code::k_busy);
+  auto res_i = res_g.or_else([](zpp::error_code e) noexcept {
+      void_result r;
+      if (e == zpp::error_code::k_busy) {
+        r.assign_value();
+      }
+      return r;
+    });
+  zassert_true(res_i == true, "or_else should recover from k_busy\n");
+}
+
 ZTEST(test_zpp_result, test_result)
 {
   zpp::result<int, zpp::error_code>   res_a;
@@ -0,0 +1,182 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+#include <zephyr/ztest.h>
+
+#include <zpp/ring_buffer.hpp>
+#include <zpp/thread.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstring>
+
+ZTEST_SUITE(zpp_ring_buffer_tests, NULL, NULL, NULL, NULL, NULL);
+
+namespace {
+
+struct sample {
+  uint16_t channel;
+  int32_t  value;
+};
+
+ZPP_THREAD_STACK_DEFINE(tstack, 1024);
+zpp::thread_data tcb;
+
+zpp::byte_ring<64, zpp::ring_sem_notify> g_rx;
+
+const zpp::thread_attr attr(
+      zpp::thread_prio::preempt(0),
+      zpp::thread_inherit_perms::no,
+      zpp::thread_essential::no,
+      zpp::thread_suspend::no
+    );
+
+// the empty notification does not make the ring bigger
+static_assert(sizeof(zpp::byte_ring<16>) ==
+              sizeof(zpp::byte_ring<16, zpp::ring_sem_notify>)
+                - sizeof(zpp::ring_sem_notify));
+
+} // namespace
+
+ZTEST(zpp_ring_buffer_tests, test_byte_claim_finish)
+{
+  zpp::byte_ring<16> r;
+
+  zassert_equal(r.capacity(), 16, "wrong capacity");
+  zassert_true(r.empty(), "new ring not empty");
+  zassert_equal(r.space(), 16, "wrong space");
+  zassert_true(r.get_claim().empty(), "claimed data of an empty ring");
+
+  auto out = r.put_claim(10);
+  zassert_equal(out.size(), 10, "wrong put claim size");
+  for (size_t i = 0; i < out.size(); ++i) {
+    out[i] = static_cast<uint8_t>(i);
+  }
+
+  // only finish part of the claim, the rest is released
+  zassert_true(r.put_finish(8) == true, "put_finish failed");
+  zassert_equal(r.size(), 8, "wrong size");
+
+  auto in = r.get_claim(3);
+  zassert_equal(in.size(), 3, "wrong get claim size");
+  zassert_equal(in[0], 0, "wrong data");
+  zassert_equal(in[2], 2, "wrong data");
+  zassert_true(r.get_finish(3) == true, "get_finish failed");
+
+  zassert_equal(r.get_finish(1).error(), zpp::error_code::k_inval,
+                "finished more than claimed");
+
+  // 5 bytes left, filling up to 16 wraps at the end of the buffer
+  out = r.put_claim();
+  zassert_equal(out.size(), 8, "claim went past the end of the buffer");
+  zassert_true(r.put_finish(out.size()) == true, "put_finish failed");
+
+  out = r.put_claim();
+  zassert_equal(out.size(), 3, "wrong claim size after wrap");
+  zassert_true(r.put_finish(out.size()) == true, "put_finish failed");
+
+  zassert_equal(r.space(), 0, "ring not full");
+  zassert_true(r.put_claim().empty(), "claimed space in a full ring");
+
+  r.reset();
+  zassert_true(r.empty(), "ring not empty after reset");
+}
+
+ZTEST(zpp_ring_buffer_tests, test_item_put_get)
+{
+  zpp::item_ring<sample, 4> r;
+
+  std::array<sample, 6> in{};
+  for (size_t i = 0; i < in.size(); ++i) {
+    in[i] = sample{ static_cast<uint16_t>(i), static_cast<int32_t>(i) * -100 };
+  }
+
+  zassert_equal(r.put(in), 4, "more items put than fit");
+  zassert_equal(r.size(), 4, "wrong size");
+
+  // claims are whole items
+  auto items = r.get_claim(3);
+  zassert_equal(items.size(), 3, "wrong claim size");
+  zassert_equal(items[1].channel, 1, "wrong item");
+  zassert_equal(items[2].value, -200, "wrong item");
+  zassert_true(r.get_finish(2) == true, "get_finish failed");
+
+  // the unfinished item stays in the ring
+  std::array<sample, 4> out{};
+  zassert_equal(r.get(out), 2, "wrong number of items");
+  zassert_equal(out[0].channel, 2, "unfinished item was removed");
+  zassert_equal(out[1].channel, 3, "wrong item");
+  zassert_true(r.empty(), "ring not empty");
+}
+
+ZTEST(zpp_ring_buffer_tests, test_sem_notify)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  auto t = thread(tcb, tstack(), attr,
+    []() noexcept {
+      for (uint8_t i = 0; i < 100; ++i) {
+        while (true) {
+          auto out = g_rx.put_claim(1);
+          if (!out.empty()) {
+            out[0] = i;
+            auto rc = g_rx.put_finish(1);
+            zassert_true(rc == true, "put_finish failed");
+            break;
+          }
+          this_thread::yield();
+        }
+      }
+    });
+
+  uint8_t expected = 0;
+
+  while (expected < 100) {
+    auto rc = g_rx.notifier().sem().try_take_for(1s);
+    zassert_true(rc == true, "no notification");
+
+    // one notification can stand for many puts
+    while (true) {
+      auto in = g_rx.get_claim();
+      if (in.empty()) {
+        break;
+      }
+
+      for (auto b : in) {
+        zassert_equal(b, expected, "bytes out of order");
+        expected++;
+      }
+
+      auto frc = g_rx.get_finish(in.size());
+      zassert_true(frc == true, "get_finish failed");
+    }
+  }
+
+  auto rc = t.join();
+  zassert_true(rc == true, "join failed");
+}
+
+#ifdef CONFIG_POLL
+ZTEST(zpp_ring_buffer_tests, test_poll_signal_notify)
+{
+  zpp::byte_ring<16, zpp::ring_poll_signal_notify> r;
+
+  auto& sig = r.notifier().signal();
+  zassert_false(sig.check().has_value(), "signal raised before put");
+
+  const uint8_t data[] = { 1, 2, 3 };
+  zassert_equal(r.put(data), 3, "put failed");
+  zassert_true(sig.check().has_value(), "signal not raised by put");
+
+  sig.reset();
+
+  auto out = r.put_claim();
+  zassert_true(r.put_finish(0) == true, "put_finish failed");
+  zassert_false(sig.check().has_value(), "signal raised without items");
+  (void)out;
+}
+#endif // CONFIG_POLL
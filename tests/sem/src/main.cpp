@@ -9,6 +9,7 @@
 #include <zephyr/kernel.h>
 
 #include <zpp/sem.hpp>
+#include <zpp/counting_sem.hpp>
 #include <zpp/thread.hpp>
 #include <zpp/utils.hpp>
 
@@ -22,6 +23,24 @@ zpp::sem_ref simple_ref_sem(&g_sem);
 
 zpp::sem simple_sem(0, 10);
 
+ZPP_THREAD_STACK_DEFINE(tstack, 1024);
+zpp::thread_data tcb;
+
+ZPP_THREAD_STACK_DEFINE(tstack2, 1024);
+zpp::thread_data tcb2;
+
+zpp::counting_sem credit_sem(0, 10);
+
+// two threads that each need 3 of the 4 credits
+zpp::counting_sem credit_pool(4, 4);
+atomic_t credit_failures;
+atomic_t credit_in_use;
+
+// a thread that needs 1 unit and a thread that needs 3 units wait for
+// units that are given one at a time
+zpp::counting_sem mixed_pool(0, 100);
+atomic_t mixed_failures;
+
 } // namespace
 
 ZTEST(test_zpp_sem, test_sem_cmp)
@@ -175,3 +194,195 @@ ZTEST(test_zpp_sem, test_sem_try_take_for_fails_ref)
                  "k_sem_take succeeded when its not possible");
   }
 }
+
+ZTEST(test_zpp_sem, test_sem_try_take_until)
+{
+  using namespace std::chrono;
+
+  simple_sem.reset();
+
+  auto deadline = zpp::uptime_clock::now() + 50ms;
+  auto ret_value = simple_sem.try_take_until(deadline);
+  zassert_true(ret_value == false,
+               "k_sem_take succeeded when its not possible");
+  zassert_true(zpp::uptime_clock::now() >= deadline,
+               "woke up before the deadline");
+
+  // a deadline in the past does not wait
+  simple_sem.give();
+  ret_value = simple_sem.try_take_until(zpp::uptime_clock::now() - 1ms);
+  zassert_true(ret_value == true, "k_sem_take failed");
+}
+
+ZTEST(test_zpp_sem, test_sem_operators)
+{
+  simple_sem.reset();
+
+  simple_sem += 3;
+  zassert_equal(simple_sem.count(), 3, "+= 3 did not give 3 units");
+
+  simple_sem -= 2;
+  zassert_equal(simple_sem.count(), 1, "-= 2 did not take 2 units");
+
+  simple_sem--;
+  zassert_equal(simple_sem.count(), 0, "operators did not balance");
+}
+
+ZTEST(test_zpp_sem, test_counting_sem_try_acquire)
+{
+  zpp::counting_sem s(0, 10);
+
+  s.release(3);
+  zassert_equal(s.count(), 3, "release(3) did not give 3 units");
+
+  auto ret_value = s.try_acquire(4);
+  zassert_false(ret_value, "try_acquire(4) succeeded with 3 units");
+  zassert_equal(s.count(), 3, "failed try_acquire took units");
+
+  ret_value = s.try_acquire(3);
+  zassert_true(ret_value, "try_acquire(3) failed with 3 units");
+  zassert_equal(s.count(), 0, "try_acquire(3) did not take 3 units");
+
+  s.release(20);
+  zassert_equal(s.count(), 10, "release went above the count limit");
+}
+
+ZTEST(test_zpp_sem, test_counting_sem_try_acquire_for_fails)
+{
+  using namespace std::chrono;
+
+  zpp::counting_sem s(2, 10);
+
+  auto deadline = zpp::uptime_clock::now() + 50ms;
+  auto ret_value = s.try_acquire_for(5, 50ms);
+  zassert_false(ret_value, "try_acquire_for(5) succeeded with 2 units");
+  zassert_true(zpp::uptime_clock::now() >= deadline,
+               "woke up before the timeout");
+  zassert_equal(s.count(), 2, "failed try_acquire_for took units");
+}
+
+ZTEST(test_zpp_sem, test_counting_sem_acquire_blocks)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  const thread_attr attr(
+        thread_prio::preempt(0),
+        thread_inherit_perms::no,
+        thread_essential::no,
+        thread_suspend::no
+      );
+
+  // give the units one by one, the waiter must block and not spin
+  auto t = thread(
+    tcb, tstack(), attr,
+    []() noexcept {
+      for (int i = 0; i < 4; ++i) {
+        this_thread::sleep_for(5ms);
+        credit_sem.release(1);
+      }
+    });
+
+  auto ret_value = credit_sem.acquire(4);
+  zassert_true(ret_value, "acquire(4) failed");
+  zassert_equal(credit_sem.count(), 0, "acquire(4) left units");
+
+  auto rc = t.join();
+  zassert_true(rc == true, "join failed");
+}
+
+ZTEST(test_zpp_sem, test_counting_sem_contention)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  const thread_attr attr(
+        thread_prio::preempt(0),
+        thread_inherit_perms::no,
+        thread_essential::no,
+        thread_suspend::no
+      );
+
+  // with partial units held while waiting both threads could end up
+  // with 2 credits each and wait for ever, the timeout turns that into
+  // a failure
+  auto worker = []() noexcept {
+      for (int i = 0; i < 200; ++i) {
+        if (!credit_pool.try_acquire_for(3, 1s)) {
+          atomic_inc(&credit_failures);
+          return;
+        }
+
+        if (atomic_inc(&credit_in_use) != 0) {
+          atomic_inc(&credit_failures);
+        }
+
+        this_thread::yield();
+
+        atomic_dec(&credit_in_use);
+        credit_pool.release(3);
+      }
+    };
+
+  auto t1 = thread(tcb, tstack(), attr, worker);
+  auto t2 = thread(tcb2, tstack2(), attr, worker);
+
+  auto rc = t1.join();
+  zassert_true(rc == true, "join failed");
+  rc = t2.join();
+  zassert_true(rc == true, "join failed");
+
+  zassert_equal(atomic_get(&credit_failures), 0, "credits deadlocked or overlapped");
+  zassert_equal(credit_pool.count(), 4, "credits lost");
+}
+
+ZTEST(test_zpp_sem, test_counting_sem_mixed_sizes)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  const thread_attr attr(
+        thread_prio::preempt(0),
+        thread_inherit_perms::no,
+        thread_essential::no,
+        thread_suspend::no
+      );
+
+  // a wake up taken by the other waiter would leave a thread asleep
+  // while its units are available, the timeout turns that into a failure
+  auto t1 = thread(
+    tcb, tstack(), attr,
+    []() noexcept {
+      for (int i = 0; i < 30; ++i) {
+        if (!mixed_pool.try_acquire_for(1, 1s)) {
+          atomic_inc(&mixed_failures);
+          return;
+        }
+      }
+    });
+
+  auto t2 = thread(
+    tcb2, tstack2(), attr,
+    []() noexcept {
+      for (int i = 0; i < 10; ++i) {
+        if (!mixed_pool.try_acquire_for(3, 1s)) {
+          atomic_inc(&mixed_failures);
+          return;
+        }
+      }
+    });
+
+  // exactly the units both threads need, one at a time
+  for (int i = 0; i < 30 + 10 * 3; ++i) {
+    this_thread::sleep_for(1ms);
+    mixed_pool.release(1);
+  }
+
+  auto rc = t1.join();
+  zassert_true(rc == true, "join failed");
+  rc = t2.join();
+  zassert_true(rc == true, "join failed");
+
+  zassert_equal(atomic_get(&mixed_failures), 0, "wake up lost");
+  zassert_equal(mixed_pool.count(), 0, "units left");
+}
@@ -0,0 +1,116 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/kernel.h>
+
+#include <zpp/stack.hpp>
+#include <zpp/thread.hpp>
+
+#include <array>
+#include <chrono>
+
+ZTEST_SUITE(test_zpp_stack, NULL, NULL, NULL, NULL, NULL);
+
+namespace {
+
+ZPP_THREAD_STACK_DEFINE(tstack, 1024);
+zpp::thread_data tcb;
+
+struct buffer {
+  std::array<uint8_t, 32> data{};
+};
+
+std::array<buffer, 4> g_buffers;
+
+zpp::stack<4, buffer*> g_stack;
+
+} // namespace
+
+ZTEST(test_zpp_stack, test_stack_values)
+{
+  zpp::stack<2> s;
+
+  zassert_true(!!s.push(1), "push failed");
+  zassert_true(!!s.push(2), "push failed");
+
+  auto rc = s.push(3);
+  zassert_false(!!rc, "push to full stack succeeded");
+  zassert_equal(rc.error(), zpp::error_code::k_nomem, "wrong error");
+
+  auto res = s.try_pop();
+  zassert_true(!!res, "pop failed");
+  zassert_equal(res.value(), 2, "wrong order");
+
+  res = s.try_pop();
+  zassert_true(!!res, "pop failed");
+  zassert_equal(res.value(), 1, "wrong order");
+
+  res = s.try_pop();
+  zassert_false(!!res, "pop from empty stack succeeded");
+  zassert_equal(res.error(), zpp::error_code::k_busy, "wrong error");
+}
+
+ZTEST(test_zpp_stack, test_stack_recycle)
+{
+  for (auto& b: g_buffers) {
+    zassert_true(!!g_stack.push(&b), "push failed");
+  }
+
+  // the most recently released buffer is handed out first
+  auto res = g_stack.try_pop();
+  zassert_true(!!res, "pop failed");
+  zassert_equal(res.value(), &g_buffers[3], "wrong buffer");
+
+  zassert_true(!!g_stack.push(res.value()), "push failed");
+
+  auto again = g_stack.try_pop();
+  zassert_true(!!again, "pop failed");
+  zassert_equal(again.value(), res.value(), "buffer not recycled");
+
+  zassert_true(!!g_stack.push(again.value()), "push failed");
+
+  for (size_t i = 0; i < g_buffers.size(); ++i) {
+    zassert_true(!!g_stack.try_pop(), "pop failed");
+  }
+}
+
+ZTEST(test_zpp_stack, test_stack_thread)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  const thread_attr attr(
+        thread_prio::preempt(0),
+        thread_inherit_perms::yes,
+        thread_essential::no,
+        thread_suspend::no
+      );
+
+  auto t = thread(
+    tcb, tstack(), attr,
+    []() noexcept {
+      auto res = g_stack.try_pop_for(1s);
+      __ASSERT_NO_MSG(res && res.value() == &g_buffers[0]);
+      auto rc = g_stack.push(res.value());
+      __ASSERT_NO_MSG(rc);
+    });
+
+  this_thread::sleep_for(10ms);
+  zassert_true(!!g_stack.push(&g_buffers[0]), "push failed");
+
+  auto rc = t.join();
+  zassert_true(!!rc, "join failed");
+
+  auto res = g_stack.try_pop_until(uptime_clock::now() + 10ms);
+  zassert_true(!!res, "pop failed");
+  zassert_equal(res.value(), &g_buffers[0], "buffer not returned");
+
+  res = g_stack.try_pop_for(10ms);
+  zassert_false(!!res, "pop from empty stack succeeded");
+  zassert_equal(res.error(), zpp::error_code::k_again, "wrong error");
+}
@@ -22,6 +22,36 @@ zpp::thread_data tcb;
 
 zpp::heap<1024> theap;
 
+atomic_t static_thread_runs;
+atomic_t suspended_thread_runs;
+
+constexpr zpp::thread_attr static_attr(
+        zpp::thread_prio::preempt(0)
+      );
+
+constexpr zpp::thread_attr suspended_attr(
+        zpp::thread_prio::preempt(0),
+        zpp::thread_suspend::yes
+      );
+
+ZPP_THREAD_DEFINE(static_thread, 1024, static_attr,
+  []() noexcept {
+    atomic_inc(&static_thread_runs);
+  });
+
+ZPP_THREAD_DEFINE(suspended_thread, 1024, suspended_attr,
+  []() noexcept {
+    atomic_inc(&suspended_thread_runs);
+  });
+
+static_assert(suspended_attr.native_delay_ms() == SYS_FOREVER_MS);
+static_assert(static_attr.native_delay_ms() == 0);
+constexpr zpp::thread_start_delay<int64_t, std::milli> start_delay{
+        std::chrono::milliseconds(10)
+      };
+
+static_assert(zpp::thread_attr(start_delay).native_delay_ms() == 10);
+
 } // namespace
 
 ZTEST(zpp_thread_tests, test_thread_creation)
@@ -202,3 +232,183 @@ ZTEST(zpp_thread_tests, test_thread_creation_params)
 
   print("Hello from main tid={}\n", this_thread::get_id());
 }
+
+ZTEST(zpp_thread_tests, test_thread_stack_unused)
+{
+  using namespace zpp;
+
+  const thread_attr attr(
+        thread_prio::preempt(0),
+        thread_inherit_perms::no,
+        thread_essential::no,
+        thread_suspend::no
+      );
+
+  auto t = thread(
+    tcb, tstack(), attr,
+    []() noexcept {
+      auto rc = this_thread::stack_unused();
+      zassert_true(rc == true, "stack_unused failed\n");
+      zassert_true(rc.value() > 0, "no stack left\n");
+      zassert_true(rc.value() <= 1024, "more stack unused than allocated\n");
+    });
+
+  auto rc = t.join();
+  zassert_true(rc == true, "join failed");
+
+  auto main_rc = this_thread::stack_unused();
+  zassert_true(main_rc == true, "stack_unused failed\n");
+
+  thread empty;
+  zassert_false(empty.stack_unused(), "stack_unused on empty thread\n");
+}
+
+ZTEST(zpp_thread_tests, test_thread_runtime_stats)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  this_thread::busy_wait_for(1ms);
+
+  auto rc = this_thread::runtime_stats();
+  zassert_true(rc == true, "runtime_stats failed\n");
+  zassert_true(rc.value().execution_cycles() > 0, "no execution cycles\n");
+
+  auto all = runtime_stats_all();
+  zassert_true(all == true, "runtime_stats_all failed\n");
+  zassert_true(all.value().execution_cycles() >= rc.value().execution_cycles(),
+               "system used less cycles than one thread\n");
+
+  thread empty;
+  zassert_false(empty.runtime_stats(), "runtime_stats on empty thread\n");
+}
+
+ZTEST(zpp_thread_tests, test_for_each_thread)
+{
+  using namespace zpp;
+
+  int count = 0;
+  bool found_self = false;
+  auto self = this_thread::get_id();
+
+  for_each_thread([&](thread_id tid) noexcept {
+    count++;
+    if (tid == self) {
+      found_self = true;
+    }
+  });
+
+  zassert_true(count >= 2, "expected at least main and idle thread\n");
+  zassert_true(found_self, "current thread not found\n");
+}
+
+ZTEST(zpp_thread_tests, test_static_thread)
+{
+  auto rc = k_thread_join(static_thread().native_handle(), K_SECONDS(1));
+  zassert_equal(rc, 0, "static thread did not finish\n");
+  zassert_equal(atomic_get(&static_thread_runs), 1,
+                "static thread did not run once\n");
+
+  zassert_equal(atomic_get(&suspended_thread_runs), 0,
+                "suspended static thread ran\n");
+
+  k_thread_start(suspended_thread().native_handle());
+
+  rc = k_thread_join(suspended_thread().native_handle(), K_SECONDS(1));
+  zassert_equal(rc, 0, "suspended static thread did not finish\n");
+  zassert_equal(atomic_get(&suspended_thread_runs), 1,
+                "suspended static thread did not run once\n");
+}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+
+static_assert(zpp::thread_cpu_mask::of<0>().native_value() == 1);
+static_assert(zpp::thread_cpu_mask::spread(0).native_value() == 1);
+static_assert(zpp::thread_cpu_mask::all().test(0));
+static_assert(zpp::thread_cpu_mask().empty());
+
+ZTEST(zpp_thread_tests, test_thread_cpu_mask)
+{
+  using namespace zpp;
+
+  const thread_attr attr(
+        thread_prio::preempt(0),
+        thread_cpu_mask::of<0>(),
+        thread_suspend::no
+      );
+
+  sem done;
+
+  auto t = thread(
+    tcb, tstack(), attr, &theap,
+    [&done]() noexcept {
+#ifdef CONFIG_SMP
+      zassert_true(arch_curr_cpu()->id == 0, "thread not on CPU 0\n");
+#endif
+      done++;
+    });
+
+  done--;
+
+  auto rc = t.join();
+  zassert_true(rc == true, "join failed");
+
+  // a mask can be changed while the thread is suspended
+  const thread_attr suspended_attr(
+        thread_prio::preempt(0),
+        thread_suspend::yes
+      );
+
+  auto t2 = thread(
+    tcb, tstack(), suspended_attr, &theap,
+    [&done]() noexcept {
+      done++;
+    });
+
+  rc = t2.pin_to_cpu(thread_cpu_mask::max_cpus);
+  zassert_false(rc, "pin to non existing CPU succeeded\n");
+
+  rc = t2.set_cpu_mask(thread_cpu_mask::spread(1, 1));
+  zassert_true(rc == true, "set_cpu_mask failed\n");
+
+  rc = t2.start();
+  zassert_true(rc == true, "start failed\n");
+
+  done--;
+
+  rc = t2.join();
+  zassert_true(rc == true, "join failed");
+
+  // a mask can not be applied to a thread that starts after a delay
+  const thread_attr delayed_attr(
+        thread_prio::preempt(0),
+        thread_cpu_mask::of<0>(),
+        start_delay
+      );
+
+  zassert_true(delayed_attr.has_start_delay(), "start delay not set\n");
+
+  auto t3 = thread(
+    tcb, tstack(), delayed_attr, &theap,
+    [&done]() noexcept {
+      done++;
+    });
+
+  zassert_false(t3, "thread with mask and start delay was created\n");
+}
+
+#endif // CONFIG_SCHED_CPU_MASK
+
+ZTEST(zpp_thread_tests, test_sleep_until)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  auto next = uptime_clock::now();
+
+  for (int i = 0; i < 5; ++i) {
+    next += 10ms;
+    this_thread::sleep_until(next);
+    zassert_true(uptime_clock::now() >= next, "woke up before deadline\n");
+  }
+}
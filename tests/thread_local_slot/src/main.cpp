@@ -0,0 +1,147 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+#include <zephyr/ztest.h>
+
+#include <zpp/thread_local_slot.hpp>
+#include <zpp/thread.hpp>
+#include <zpp/heap.hpp>
+
+ZTEST_SUITE(zpp_thread_local_slot_tests, NULL, NULL, NULL, NULL, NULL);
+
+namespace {
+
+ZPP_THREAD_STACK_ARRAY_DEFINE(tstack, 3, 1024);
+zpp::thread_data tcb[3];
+
+zpp::heap<1024> theap;
+
+int constructed;
+int destroyed;
+
+struct counted {
+  explicit counted(int v) noexcept
+    : value(v)
+  {
+    constructed++;
+  }
+
+  ~counted() noexcept
+  {
+    destroyed++;
+  }
+
+  int value;
+};
+
+struct scratch {
+  int value{ 0 };
+};
+
+const zpp::thread_attr attr(
+      zpp::thread_prio::preempt(0),
+      zpp::thread_inherit_perms::no,
+      zpp::thread_essential::no,
+      zpp::thread_suspend::no
+    );
+
+} // namespace
+
+ZTEST(zpp_thread_local_slot_tests, test_lazy_construction)
+{
+  constructed = 0;
+  destroyed = 0;
+
+  {
+    zpp::thread_local_slot<counted, 4> slot;
+
+    zassert_is_null(slot.find(), "value before first get");
+    zassert_equal(slot.size(), 0, "slot not empty");
+
+    auto p = slot.get(42);
+    zassert_not_null(p, "get failed");
+    zassert_equal(p->value, 42, "wrong value");
+    zassert_equal(constructed, 1, "value not constructed once");
+
+    // the arguments are only used for the first get
+    zassert_equal_ptr(slot.get(7), p, "second get returned other value");
+    zassert_equal(p->value, 42, "value constructed again");
+    zassert_equal(constructed, 1, "value constructed again");
+    zassert_equal_ptr(slot.find(), p, "find returned other value");
+    zassert_equal(slot.size(), 1, "wrong size");
+
+    zassert_true(slot.reset(), "reset failed");
+    zassert_equal(destroyed, 1, "value not destroyed by reset");
+    zassert_false(slot.reset(), "second reset succeeded");
+    zassert_is_null(slot.find(), "value after reset");
+
+    p = slot.get(7);
+    zassert_not_null(p, "get after reset failed");
+    zassert_equal(p->value, 7, "wrong value after reset");
+  }
+
+  // the slot destroys the values that are still there
+  zassert_equal(constructed, 2, "wrong number of constructions");
+  zassert_equal(destroyed, 2, "value not destroyed with the slot");
+}
+
+ZTEST(zpp_thread_local_slot_tests, test_value_per_thread)
+{
+  using namespace zpp;
+
+  thread_local_slot<scratch, 3> slot;
+  scratch* values[2]{};
+
+  auto self = slot.get();
+  zassert_not_null(self, "get failed");
+  self->value = -1;
+
+  thread t[2];
+
+  for (int i = 0; i < 2; ++i) {
+    t[i] = thread(tcb[i], tstack(i), attr, &theap,
+      [&slot, &values, i]() noexcept {
+        auto p = slot.get();
+        zassert_not_null(p, "get in thread failed");
+        zassert_equal(p->value, 0, "thread got value of other thread");
+        p->value = i;
+        values[i] = p;
+      });
+  }
+
+  for (int i = 0; i < 2; ++i) {
+    auto rc = t[i].join();
+    zassert_true(rc == true, "join failed");
+  }
+
+  zassert_not_null(values[0], "thread 0 has no value");
+  zassert_not_null(values[1], "thread 1 has no value");
+  zassert_not_equal(values[0], values[1], "threads share a value");
+  zassert_not_equal(values[0], self, "thread shares value with main");
+  zassert_equal(values[0]->value, 0, "value of thread 0 changed");
+  zassert_equal(values[1]->value, 1, "value of thread 1 changed");
+  zassert_equal(self->value, -1, "value of main changed");
+  zassert_equal(slot.size(), 3, "wrong size");
+
+  // all entries are in use
+  auto extra = thread(tcb[2], tstack(2), attr, &theap,
+    [&slot]() noexcept {
+      zassert_is_null(slot.get(), "get succeeded on a full slot");
+    });
+
+  auto rc = extra.join();
+  zassert_true(rc == true, "join failed");
+
+  // release the entries of the threads that are done
+  zassert_true(slot.reset(thread_id(tcb[0].native_handle())),
+               "reset of thread 0 failed");
+  zassert_true(slot.reset(thread_id(tcb[1].native_handle())),
+               "reset of thread 1 failed");
+  zassert_false(slot.reset(thread_id(tcb[1].native_handle())),
+                "second reset succeeded");
+  zassert_equal(slot.size(), 1, "wrong size after reset");
+  zassert_equal_ptr(slot.find(), self, "main lost its value");
+}
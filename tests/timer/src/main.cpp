@@ -8,6 +8,7 @@
 
 #include <zephyr/kernel.h>
 
+#include <zpp/atomic_var.hpp>
 #include <zpp/timer.hpp>
 #include <zpp/thread.hpp>
 #include <zpp/fmt.hpp>
@@ -51,3 +52,57 @@ ZTEST(zpp_timer_tests, test_timer_creation_lambda)
 
   this_thread::sleep_for(5s);
 }
+
+ZTEST(zpp_timer_tests, test_deferred_timer_thread_context)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  static atomic_var s_calls;
+  static atomic_var s_in_isr;
+
+  auto t = make_deferred_timer(
+    [] (auto t) noexcept {
+      if (k_is_in_isr()) {
+        s_in_isr.fetch_inc();
+      }
+      s_calls.fetch_inc();
+    } );
+
+  t.start(10ms, 10ms);
+
+  this_thread::sleep_for(105ms);
+
+  t.stop();
+
+  zassert_true(s_calls.load() > 0, "");
+  zassert_equal(s_in_isr.load(), 0, "");
+}
+
+ZTEST(zpp_timer_tests, test_deferred_timer_overruns)
+{
+  using namespace zpp;
+  using namespace std::chrono;
+
+  static atomic_var s_calls;
+  static atomic_var s_expiries;
+
+  auto t = make_deferred_timer(
+    [] (auto t, auto count) noexcept {
+      s_calls.fetch_inc();
+      s_expiries.fetch_add(count);
+      // keep the work queue busy for several timer periods
+      k_busy_wait(5000);
+    } );
+
+  t.start(1ms, 1ms);
+
+  this_thread::sleep_for(50ms);
+
+  t.stop();
+  this_thread::sleep_for(20ms);
+
+  zassert_true(s_calls.load() > 0, "");
+  zassert_true(s_calls.load() < s_expiries.load(), "");
+  zassert_equal(s_expiries.load() - s_calls.load(), t.overruns(), "");
+}
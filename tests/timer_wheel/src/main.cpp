@@ -0,0 +1,146 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/kernel.h>
+
+#include <zpp/timer_wheel.hpp>
+#include <zpp/thread.hpp>
+
+#include <array>
+#include <chrono>
+
+ZTEST_SUITE(zpp_timer_wheel_tests, NULL, NULL, NULL, NULL, NULL);
+
+namespace {
+
+struct connection : zpp::timer_wheel_entry {
+  connection() noexcept
+    : zpp::timer_wheel_entry(&on_timeout)
+  {
+  }
+
+  static void on_timeout(zpp::timer_wheel_entry& e) noexcept
+  {
+    auto& self = static_cast<connection&>(e);
+    self.fired++;
+  }
+
+  int fired{ 0 };
+};
+
+// the wheel is driven by hand, the internal tick is too slow to interfere
+using wheel_type = zpp::timer_wheel<8, 3>;
+
+template<class T_Wheel>
+void advance(T_Wheel& w, uint64_t ticks) noexcept
+{
+  for (uint64_t i = 0; i < ticks; ++i) {
+    w.tick();
+  }
+}
+
+} // namespace
+
+ZTEST(zpp_timer_wheel_tests, test_expire_levels)
+{
+  using namespace std::chrono;
+
+  wheel_type w(1h);
+
+  // one timer on every level, and one beyond the wheel range
+  std::array<connection, 4> c;
+  const std::array<uint64_t, 4> ticks{ 3, 20, 300, wheel_type::max_ticks + 100 };
+
+  for (size_t i = 0; i < c.size(); ++i) {
+    w.start_ticks(c[i], ticks[i]);
+    zassert_true(c[i].is_active(), "entry not active");
+  }
+
+  uint64_t elapsed = 0;
+  for (size_t i = 0; i < c.size(); ++i) {
+    advance(w, ticks[i] - 1 - elapsed);
+    zassert_equal(c[i].fired, 0, "expired too early");
+
+    w.tick();
+    elapsed = ticks[i];
+    zassert_equal(c[i].fired, 1, "did not expire on time");
+    zassert_false(c[i].is_active(), "expired entry still active");
+  }
+}
+
+ZTEST(zpp_timer_wheel_tests, test_stop_restart)
+{
+  using namespace std::chrono;
+
+  wheel_type w(1h);
+  connection a;
+  connection b;
+
+  w.start_ticks(a, 5);
+  w.start_ticks(b, 5);
+
+  zassert_true(w.stop(a), "stop of running entry failed");
+  zassert_false(w.stop(a), "stopped twice");
+
+  advance(w, 3);
+  w.start_ticks(b, 5);
+  zassert_equal(w.remaining(b), 5h, "wrong remaining time");
+
+  advance(w, 4);
+  zassert_equal(b.fired, 0, "restart did not move the deadline");
+  w.tick();
+  zassert_equal(b.fired, 1, "restarted entry did not expire");
+  zassert_equal(a.fired, 0, "stopped entry expired");
+  zassert_equal(w.remaining(b), 0h, "expired entry has remaining time");
+}
+
+ZTEST(zpp_timer_wheel_tests, test_callback_restart)
+{
+  using namespace std::chrono;
+
+  static wheel_type* g_wheel;
+
+  struct periodic_entry : zpp::timer_wheel_entry {
+    periodic_entry() noexcept
+      : zpp::timer_wheel_entry([](zpp::timer_wheel_entry& e) noexcept {
+          auto& self = static_cast<periodic_entry&>(e);
+          if (++self.fired < 3) {
+            g_wheel->start_ticks(self, 10);
+          }
+        })
+    {
+    }
+
+    int fired{ 0 };
+  };
+
+  wheel_type w(1h);
+  g_wheel = &w;
+
+  periodic_entry p;
+  w.start_ticks(p, 10);
+
+  advance(w, 100);
+  zassert_equal(p.fired, 3, "wrong number of expiries");
+  zassert_false(p.is_active(), "entry still active");
+}
+
+ZTEST(zpp_timer_wheel_tests, test_real_time)
+{
+  using namespace std::chrono;
+
+  zpp::timer_wheel<16, 2> w(1ms);
+  connection c;
+
+  w.start(c, 20ms);
+  zpp::this_thread::sleep_for(10ms);
+  zassert_equal(c.fired, 0, "expired too early");
+
+  zpp::this_thread::sleep_for(30ms);
+  zassert_equal(c.fired, 1, "did not expire");
+}
@@ -0,0 +1,124 @@
+/*
+* Copyright (c) 2026 Erwin Rol <erwin@erwinrol.com>
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+#include <zephyr/ztest.h>
+
+#include <zpp/triple_buffer.hpp>
+#include <zpp/thread.hpp>
+
+#include <chrono>
+
+ZTEST_SUITE(zpp_triple_buffer_tests, NULL, NULL, NULL, NULL, NULL);
+
+namespace {
+
+// large enough that a torn copy would show up as mixed values
+struct state_block {
+  uint32_t values[512];
+};
+
+constexpr uint32_t num_writes = 20000;
+
+ZPP_THREAD_STACK_DEFINE(tstack, 1024);
+zpp::thread_data tcb;
+
+zpp::triple_buffer<state_block> g_state;
+
+void fill(state_block& b, uint32_t v) noexcept
+{
+  for (auto& x : b.values) {
+    x = v;
+  }
+}
+
+} // namespace
+
+ZTEST(zpp_triple_buffer_tests, test_latest_value)
+{
+  zpp::triple_buffer<int> tb(-1);
+
+  zassert_false(tb.has_update(), "update before publish");
+  zassert_false(tb.update(), "update before publish");
+  zassert_equal(tb.read_buffer(), -1, "wrong initial value");
+
+  tb.write_buffer() = 1;
+  tb.publish();
+
+  zassert_true(tb.has_update(), "no update after publish");
+  zassert_true(tb.update(), "no update after publish");
+  zassert_equal(tb.read_buffer(), 1, "wrong value");
+  zassert_false(tb.update(), "second update without publish");
+  zassert_equal(tb.read_buffer(), 1, "value changed without update");
+
+  // the reader only gets the latest of several values
+  for (int i = 2; i <= 5; ++i) {
+    tb.write_buffer() = i;
+    tb.publish();
+  }
+
+  zassert_true(tb.update(), "no update after publish");
+  zassert_equal(tb.read_buffer(), 5, "not the latest value");
+
+  // buffers are filled in place, the writer never gets the front buffer
+  const int* front = &tb.read_buffer();
+  for (int i = 6; i <= 10; ++i) {
+    zassert_not_equal(&tb.write_buffer(), front, "writer got the front buffer");
+    tb.write_buffer() = i;
+    tb.publish();
+  }
+}
+
+ZTEST(zpp_triple_buffer_tests, test_no_tearing)
+{
+  using namespace zpp;
+
+  // the reader yields to the writer, which only works when the writer
+  // does not have a lower priority than the (cooperative) test thread
+  const thread_attr attr(
+        this_thread::get_priority(),
+        thread_inherit_perms::no,
+        thread_essential::no,
+        thread_suspend::no
+      );
+
+  auto t = thread(tcb, tstack(), attr,
+    []() noexcept {
+      for (uint32_t i = 1; i <= num_writes; ++i) {
+        fill(g_state.write_buffer(), i);
+        g_state.publish();
+
+        if (i % 64 == 0) {
+          this_thread::yield();
+        }
+      }
+    });
+
+  uint32_t last = 0;
+  uint32_t updates = 0;
+
+  while (last < num_writes) {
+    if (!g_state.update()) {
+      this_thread::yield();
+      continue;
+    }
+
+    const auto& b = g_state.read_buffer();
+    auto v = b.values[0];
+
+    zassert_true(v > last, "value went back from %u to %u", last, v);
+
+    for (auto x : b.values) {
+      zassert_equal(x, v, "torn read, %u in a block of %u", x, v);
+    }
+
+    last = v;
+    updates++;
+  }
+
+  auto rc = t.join();
+  zassert_true(rc == true, "join failed");
+  zassert_true(updates > 0, "reader got no updates");
+}